@@ -3,4 +3,7 @@
 #include "MySkully.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogSkullyMovement);
+DEFINE_LOG_CATEGORY(LogSkullyUI);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, MySkully, "MySkully" );
@@ -1,24 +1,246 @@
 /*
 * 파일명: MainGameModeBase.h
  * 생성일: 2026-01-07
- * 수정일: 2026-01-09
+ * 수정일: 2026-10-17
  * 내용: 메인 화면 게임 모드
  */
 
 #include "GameFramework/MainGameModeBase.h"
 #include "Blueprint/UserWidget.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "MySkully.h"
 
 AMainGameModeBase::AMainGameModeBase()
 {
 }
 
+void AMainGameModeBase::BeginPlay()
+{
+	Super::BeginPlay();
+	
+	// mainWidget/optionWidget은 BP_MainGameModeBase가 직접 만들어 SetWidget하면 그 인스턴스가 풀에 들어가므로 미리 만들지 않음
+	// (미리 만들면 보이지 않는 인스턴스가 하나 더 생김)
+	PreloadWidgetClasses();
+}
+
+void AMainGameModeBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (preloadHandle.IsValid() == true)
+	{
+		preloadHandle->CancelHandle();
+		preloadHandle.Reset();
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
 void AMainGameModeBase::SetWidget(UUserWidget* widget)
 {
-	if (currentWidget != nullptr)
+	if (widget == nullptr)
+	{
+		return;
+	}
+	
+	// 블루프린트에서 만든 위젯도 클래스별로 재사용: 처음 들어온 인스턴스를 풀에 넣고,
+	// 같은 클래스의 새 인스턴스가 들어오면 뷰포트에 추가하지 않고 풀의 인스턴스를 보여줌(새 인스턴스는 GC)
+	UClass* widgetClass = widget->GetClass();
+	if (TObjectPtr<UUserWidget>* pooledWidget = widgetPool.Find(widgetClass))
 	{
-		currentWidget->RemoveFromParent();
+		widget = *pooledWidget;
+	}
+	else
+	{
+		widgetPool.Add(widgetClass, widget);
 	}
 	
+	RegisterWidget(widget);
+	
+	if (widgetStack.Num() > 0)
+	{
+		UUserWidget* oldWidget = widgetStack.Pop();
+		if (oldWidget != widget)
+		{
+			ReleaseWidget(oldWidget);
+		}
+	}
+	
+	widgetStack.Add(widget);
 	currentWidget = widget;
-	currentWidget->AddToViewport();
+	ShowPooledWidget(widget);
+}
+
+UUserWidget* AMainGameModeBase::ShowWidget(TSubclassOf<UUserWidget> widgetClass)
+{
+	UUserWidget* widget = GetPooledWidget(widgetClass);
+	SetWidget(widget);
+	return widget;
+}
+
+UUserWidget* AMainGameModeBase::PushWidget(TSubclassOf<UUserWidget> widgetClass)
+{
+	UUserWidget* widget = GetPooledWidget(widgetClass);
+	if (widget == nullptr)
+	{
+		return nullptr;
+	}
+	
+	// 같은 위젯이 이미 스택에 있으면 그 위로 쌓인 위젯은 되돌림
+	const int32 existingIndex = widgetStack.Find(widget);
+	if (existingIndex != INDEX_NONE)
+	{
+		while (widgetStack.Num() > existingIndex + 1)
+		{
+			ReleaseWidget(widgetStack.Pop());
+		}
+	}
+	else
+	{
+		if (currentWidget != nullptr)
+		{
+			HidePooledWidget(currentWidget);
+		}
+		
+		widgetStack.Add(widget);
+	}
+	
+	currentWidget = widget;
+	ShowPooledWidget(widget);
+	return widget;
+}
+
+void AMainGameModeBase::PopWidget()
+{
+	// 맨 아래 위젯(메인 화면)은 남겨둠
+	if (widgetStack.Num() <= 1)
+	{
+		return;
+	}
+	
+	ReleaseWidget(widgetStack.Pop());
+	
+	currentWidget = widgetStack.Last();
+	ShowPooledWidget(currentWidget);
+}
+
+UUserWidget* AMainGameModeBase::GetPooledWidget(TSubclassOf<UUserWidget> widgetClass)
+{
+	if (widgetClass == nullptr)
+	{
+		return nullptr;
+	}
+	
+	if (TObjectPtr<UUserWidget>* pooledWidget = widgetPool.Find(widgetClass.Get()))
+	{
+		return *pooledWidget;
+	}
+	
+	// 위젯 생성 비용 측정(생성 + 뷰포트 추가 시 Slate 위젯 구성 포함)
+	const double startTime = FPlatformTime::Seconds();
+	
+	UUserWidget* widget = CreateWidget<UUserWidget>(GetWorld(), widgetClass);
+	if (widget == nullptr)
+	{
+		return nullptr;
+	}
+	
+	RegisterWidget(widget);
+	widgetPool.Add(widgetClass.Get(), widget);
+	
+	UE_LOG(LogSkullyUI, Log, TEXT("[UI] 위젯 생성 %s: %.2f ms"), *widgetClass->GetName(), (FPlatformTime::Seconds() - startTime) * 1000.0);
+	
+	return widget;
+}
+
+void AMainGameModeBase::RegisterWidget(UUserWidget* widget)
+{
+	if (shownVisibility.Contains(widget) == true)
+	{
+		return;
+	}
+	
+	shownVisibility.Add(widget, widget->GetVisibility());
+	widget->SetVisibility(ESlateVisibility::Collapsed);
+	widget->AddToViewport();
+}
+
+void AMainGameModeBase::ShowPooledWidget(UUserWidget* widget)
+{
+	// 블루프린트에서 직접 RemoveFromParent한 경우 다시 추가
+	if (widget->IsInViewport() == false)
+	{
+		widget->AddToViewport();
+	}
+	
+	const ESlateVisibility* visibility = shownVisibility.Find(widget);
+	widget->SetVisibility(visibility != nullptr ? *visibility : ESlateVisibility::SelfHitTestInvisible);
+}
+
+void AMainGameModeBase::HidePooledWidget(UUserWidget* widget)
+{
+	if (widget != nullptr)
+	{
+		widget->SetVisibility(ESlateVisibility::Collapsed);
+	}
+}
+
+void AMainGameModeBase::ReleaseWidget(UUserWidget* widget)
+{
+	if (widget == nullptr)
+	{
+		return;
+	}
+	
+	// 재사용 위젯은 숨기기만 하고, 풀에 없는 위젯(풀에 다른 인스턴스가 있던 위젯)은 다시 쓰이지 않으므로 뷰포트에서 제거
+	if (widgetPool.FindKey(widget) != nullptr)
+	{
+		HidePooledWidget(widget);
+		return;
+	}
+	
+	// 스택의 아래쪽(PushWidget 이전)에도 남아 있으면 아직 쓰는 위젯
+	if (widgetStack.Contains(widget) == true)
+	{
+		HidePooledWidget(widget);
+		return;
+	}
+	
+	shownVisibility.Remove(widget);
+	widget->RemoveFromParent();
+}
+
+void AMainGameModeBase::PreloadWidgetClasses()
+{
+	TArray<FSoftObjectPath> classPaths;
+	for (const TSoftClassPtr<UUserWidget>& widgetClass : preloadWidgetClasses)
+	{
+		if (widgetClass.IsNull() == false)
+		{
+			classPaths.Add(widgetClass.ToSoftObjectPath());
+		}
+	}
+	
+	if (classPaths.Num() == 0)
+	{
+		return;
+	}
+	
+	preloadRequestTime = FPlatformTime::Seconds();
+	preloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(classPaths,
+		FStreamableDelegate::CreateUObject(this, &AMainGameModeBase::OnWidgetClassesPreloaded));
+}
+
+void AMainGameModeBase::OnWidgetClassesPreloaded()
+{
+	UE_LOG(LogSkullyUI, Log, TEXT("[UI] 위젯 클래스 %d개 프리로드: %.1f ms"), preloadWidgetClasses.Num(), (FPlatformTime::Seconds() - preloadRequestTime) * 1000.0);
+	
+	if (bPrewarmWidgets == true)
+	{
+		for (const TSoftClassPtr<UUserWidget>& widgetClass : preloadWidgetClasses)
+		{
+			GetPooledWidget(widgetClass.Get());
+		}
+	}
+	
+	preloadHandle.Reset();
 }
@@ -1,7 +1,7 @@
 /*
 * 파일명: Skully.cpp
 * 생성일: 2026-01-08
-* 수정일: 2026-01-09
+* 수정일: 2026-10-17
 * 내용: 플레이어 객체 Skully
 */
 
@@ -11,13 +11,28 @@
 #include "EnhancedInputComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Components/ArrowComponent.h"
-#include "GameFramework/SpringArmComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StreamableManager.h"
 #include "Skully/SkullyMovementComponent.h"
+#include "Skully/SkullyRewindSubsystem.h"
+#include "Skully/SkullySpringArmComponent.h"
+#include "Skully/SkullyStreamingSourceComponent.h"
+#include "MySkully.h"
 
 ASkully::ASkully()
 {
- 	PrimaryActorTick.bCanEverTick = false;
-	
+	// 입력 녹화/재생 중에만 Tick을 켬
+ 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	// 이동은 USkullyMovementComponent가 예측 무브/상태 스냅샷으로 직접 동기화하므로 액터 이동 복제는 끔
+	bReplicates = true;
+	SetReplicatingMovement(false);
+
 	// 콜라이더 생성
 	SphereComponent = CreateDefaultSubobject<USphereComponent>(TEXT("SphereComponent"));
 	RootComponent = SphereComponent;
@@ -29,28 +44,26 @@ ASkully::ASkully()
 	ArrowComponent->SetupAttachment(RootComponent);
 	ArrowComponent->ArrowLength = 150.0f;
 	
-	// 스켈레탈 메시(Skully_Bone) 생성
+	// 스켈레탈 메시(Skully_Bone) 생성(메시는 BeginPlay에서 비동기 로드)
 	Skully_Bone = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Skully_BoneMesh"));
-	static ConstructorHelpers::FObjectFinder<USkeletalMesh> Skully_BoneMesh(TEXT("/Game/Character/Skully/Bone/Skully_Bone.Skully_Bone"));
-	if (Skully_BoneMesh.Succeeded() == true)
-	{
-		Skully_Bone->SetSkeletalMesh(Skully_BoneMesh.Object);
-		Skully_Bone->SetupAttachment(RootComponent);
-		Skully_Bone->SetRelativeLocation(FVector(10.0f, 0.0f, -8.0f));
-	}
+	Skully_Bone->SetupAttachment(RootComponent);
+	Skully_Bone->SetRelativeLocation(FVector(10.0f, 0.0f, -8.0f));
+	BoneMeshAsset = TSoftObjectPtr<USkeletalMesh>(FSoftObjectPath(TEXT("/Game/Character/Skully/Bone/Skully_Bone.Skully_Bone")));
 	
-	// 스태틱 메시(Skully_Clay) 생성
+	// 스태틱 메시(Skully_Clay) 생성(로드 전까지는 플레이스홀더 구를 보여줌)
 	Skully_Clay = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Skully_ClayMesh"));
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> Skully_ClayMesh(TEXT("/Game/Character/Skully/Clay/Skully_Clay.Skully_Clay"));
-	if (Skully_ClayMesh.Succeeded() == true)
+	Skully_Clay->SetupAttachment(RootComponent);
+	Skully_Clay->SetRelativeLocation(FVector(20.0f, 0.0f, -8.0f));
+	ClayMeshAsset = TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(TEXT("/Game/Character/Skully/Clay/Skully_Clay.Skully_Clay")));
+	
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaceholderSphere(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (PlaceholderSphere.Succeeded() == true)
 	{
-		Skully_Clay->SetStaticMesh(Skully_ClayMesh.Object);
-		Skully_Clay->SetupAttachment(RootComponent);
-		Skully_Clay->SetRelativeLocation(FVector(20.0f, 0.0f, -8.0f));
+		PlaceholderMesh = PlaceholderSphere.Object;
 	}
 	
-	// 스프링 암 생성
-	CameraSpringArm = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraSpringArm"));;
+	// 스프링 암 생성(카메라 충돌 스윕은 폰/컨트롤 회전이 변할 때만 수행)
+	CameraSpringArm = CreateDefaultSubobject<USkullySpringArmComponent>(TEXT("CameraSpringArm"));
 	CameraSpringArm->SetupAttachment(RootComponent);
 	CameraSpringArm->bUsePawnControlRotation = true;
 	CameraSpringArm->TargetArmLength = 1800.0f;
@@ -64,6 +77,9 @@ ASkully::ASkully()
 	// 무브먼트 컴포넌트 생성
 	MovementComponent = CreateDefaultSubobject<USkullyMovementComponent>(TEXT("MovementComponent"));
 	MovementComponent->UpdatedComponent = SphereComponent;
+	
+	// 예측 스트리밍 소스 생성(빠르게 미끄러질 때 진행 방향의 셀을 미리 로드)
+	StreamingSourceComponent = CreateDefaultSubobject<USkullyStreamingSourceComponent>(TEXT("StreamingSource"));
 		
 	// 폰 설정
 	// 컨트롤러 주입
@@ -74,16 +90,96 @@ ASkully::ASkully()
 	bUseControllerRotationRoll = false;
 }
 
+void ASkully::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+	
+#if WITH_EDITOR
+	// 에디터 뷰포트/블루프린트 미리보기에서는 동기 로드로 바로 보여줌
+	UWorld* World = GetWorld();
+	if (World != nullptr && World->IsGameWorld() == false)
+	{
+		BoneMeshAsset.LoadSynchronous();
+		ClayMeshAsset.LoadSynchronous();
+		ApplyMeshAssets();
+	}
+#endif
+}
+
 void ASkully::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	RequestMeshAssets();
+	
+	// 고정 스텝 모드의 렌더 보간 대상 메시 등록
+	MovementComponent->SetInterpolatedVisualComponents({ Skully_Bone, Skully_Clay });
+	
+	// 녹화 시 같은 틱의 입력이 이동에 반영되도록 무브먼트 컴포넌트는 액터 Tick 이후에 실행
+	MovementComponent->AddTickPrerequisiteActor(this);
+	
+	// 퍼즐 재시도용 되감기 기록(네트워크 예측/보정과 충돌하므로 단독 실행에서만)
+	if (GetNetMode() == NM_Standalone)
+	{
+		if (USkullyRewindSubsystem* Rewind = GetWorld()->GetSubsystem<USkullyRewindSubsystem>())
+		{
+			Rewind->RegisterBody(MovementComponent);
+		}
+	}
+}
+
+void ASkully::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 로드 중이면 취소(완료 콜백이 파괴된 폰에 적용되지 않도록)
+	if (MeshLoadHandle.IsValid() == true)
+	{
+		MeshLoadHandle->CancelHandle();
+		MeshLoadHandle.Reset();
+	}
+	
+	if (USkullyRewindSubsystem* Rewind = GetWorld()->GetSubsystem<USkullyRewindSubsystem>())
+	{
+		Rewind->UnregisterBody(MovementComponent);
+	}
+	
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASkully::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
-
+	
+	// 입력 재생: 녹화된 DeltaTime과 입력으로 무브먼트 컴포넌트를 직접 진행
+	if (InputReplayer.IsPlaying() == true)
+	{
+		FVector WorldInput;
+		float ReplayDeltaTime;
+		FRotator ControlRotation;
+		if (InputReplayer.Next(WorldInput, ReplayDeltaTime, ControlRotation) == true)
+		{
+			if (Controller != nullptr)
+			{
+				Controller->SetControlRotation(ControlRotation);
+			}
+			
+			MovementComponent->TickWithInput(ReplayDeltaTime, WorldInput);
+		}
+		else
+		{
+			StopInputReplay();
+		}
+	}
+	
+	// 입력 녹화: 무브먼트 컴포넌트가 이번 틱에 소비할 월드 기준 입력을 한 프레임으로 기록
+	// 컨트롤 회전/레거시 입력 스케일이 이미 반영된 값이라 재생 시 다시 계산하지 않음
+	if (bIsRecordingInput == true)
+	{
+		FSkullyInputFrame Frame;
+		Frame.WorldMove = FVector2D(GetPendingMovementInputVector());
+		Frame.ControlRotation = Controller != nullptr ? Controller->GetControlRotation() : GetActorRotation();
+		Frame.DeltaTime = DeltaTime;
+		RecordedInput.AddFrame(Frame);
+	}
 }
 
 void ASkully::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -110,16 +206,16 @@ void ASkully::Move(const FInputActionValue& Value)
 {
 	FVector2D MovementVector = Value.Get<FVector2D>();
 	
+	// 재생 중에는 실제 입력 무시
+	if (InputReplayer.IsPlaying() == true)
+	{
+		return;
+	}
+	
 	if (Controller != nullptr)
 	{
-		const FRotator Rotation = Controller->GetControlRotation();
-		const FRotator YawRotation(0.0, Rotation.Yaw, 0.0);
-		
-		const FVector ForwardDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X);
-		const FVector RightDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
-		
-		AddMovementInput(ForwardDirection, MovementVector.Y);
-		AddMovementInput(RightDirection, MovementVector.X);
+		// 입력 재생과 같은 계산을 사용
+		AddMovementInput(SkullyInput::ToWorldMoveInput(MovementVector, Controller->GetControlRotation()));
 	}
 }
 
@@ -128,9 +224,150 @@ void ASkully::Look(const FInputActionValue& Value)
 {
 	FVector2D LookAxisVector = Value.Get<FVector2D>();
 	
+	// 재생 중에는 실제 입력 무시
+	if (InputReplayer.IsPlaying() == true)
+	{
+		return;
+	}
+	
 	if (Controller != nullptr)
 	{
 		AddControllerYawInput(LookAxisVector.X);
 		AddControllerPitchInput(LookAxisVector.Y);
 	}
 }
+
+// 입력 녹화 시작
+void ASkully::StartInputRecording()
+{
+	RecordedInput.Reset();
+	// 재생할 때 같은 지점/속도/카메라에서 시작하도록 시작 상태 저장
+	RecordedInput.SetInitialState(MovementComponent->CaptureSnapshot(), Controller != nullptr ? Controller->GetControlRotation() : GetActorRotation());
+	bIsRecordingInput = true;
+	UpdateTickEnabled();
+	
+	UE_LOG(LogSkullyMovement, Display, TEXT("[Input] 녹화 시작"));
+}
+
+// 입력 녹화 종료 후 저장
+bool ASkully::StopInputRecording(const FString& NameOrPath)
+{
+	if (bIsRecordingInput == false)
+	{
+		return false;
+	}
+	
+	bIsRecordingInput = false;
+	UpdateTickEnabled();
+	
+	const FString FilePath = FSkullyInputStream::ResolveFilePath(NameOrPath);
+	const bool bSaved = RecordedInput.SaveToFile(FilePath);
+	
+	UE_LOG(LogSkullyMovement, Display, TEXT("[Input] 녹화 종료: %d프레임(%.2f초) -> %s%s"),
+		RecordedInput.Num(), RecordedInput.GetDuration(), *FilePath, bSaved ? TEXT("") : TEXT(" (저장 실패)"));
+	
+	return bSaved;
+}
+
+// 녹화된 입력 재생 시작
+bool ASkully::StartInputReplay(const FString& NameOrPath)
+{
+	FSkullyInputStream Stream;
+	const FString FilePath = FSkullyInputStream::ResolveFilePath(NameOrPath);
+	if (Stream.LoadFromFile(FilePath) == false)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Input] 입력 파일을 읽을 수 없습니다: %s"), *FilePath);
+		return false;
+	}
+	
+	// 녹화 시작 시점의 이동 상태와 컨트롤 회전 복원
+	MovementComponent->RestoreSnapshot(Stream.GetInitialState());
+	if (Controller != nullptr)
+	{
+		Controller->SetControlRotation(Stream.GetInitialControlRotation());
+	}
+	
+	InputReplayer.Start(Stream);
+	// 재생 중에는 컴포넌트 Tick 대신 액터 Tick에서 녹화된 DeltaTime으로 진행
+	MovementComponent->SetComponentTickEnabled(false);
+	UpdateTickEnabled();
+	
+	UE_LOG(LogSkullyMovement, Display, TEXT("[Input] 재생 시작: %d프레임(%.2f초) <- %s"), Stream.Num(), Stream.GetDuration(), *FilePath);
+	
+	return true;
+}
+
+// 입력 재생 종료
+void ASkully::StopInputReplay()
+{
+	InputReplayer.Stop();
+	MovementComponent->SetComponentTickEnabled(true);
+	UpdateTickEnabled();
+}
+
+void ASkully::UpdateTickEnabled()
+{
+	SetActorTickEnabled(bIsRecordingInput == true || InputReplayer.IsPlaying() == true);
+}
+
+// 메시 에셋 비동기 로드 요청
+void ASkully::RequestMeshAssets()
+{
+	// 이미 메모리에 있으면(다른 Skully가 먼저 로드) 바로 적용
+	if (BoneMeshAsset.IsPending() == false && ClayMeshAsset.IsPending() == false)
+	{
+		ApplyMeshAssets();
+		return;
+	}
+	
+	// 로드 전까지 Skully_Clay 자리에 콜라이더 크기의 플레이스홀더 구를 보여줌(엔진 기본 구의 반지름은 50)
+	// 생성자/BP_Skully에서 지정한 스케일은 저장해 두었다가 실제 메시를 적용할 때 되돌림
+	if (PlaceholderMesh != nullptr)
+	{
+		ClayAuthoredScale = Skully_Clay->GetRelativeScale3D();
+		bClayPlaceholderShown = true;
+		Skully_Clay->SetStaticMesh(PlaceholderMesh);
+		Skully_Clay->SetRelativeScale3D(FVector(SphereComponent->GetUnscaledSphereRadius() / 50.0f));
+	}
+	
+	TArray<FSoftObjectPath> AssetPaths;
+	AssetPaths.Add(BoneMeshAsset.ToSoftObjectPath());
+	AssetPaths.Add(ClayMeshAsset.ToSoftObjectPath());
+	
+	MeshLoadRequestTime = FPlatformTime::Seconds();
+	MeshLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths,
+		FStreamableDelegate::CreateUObject(this, &ASkully::OnMeshAssetsLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void ASkully::OnMeshAssetsLoaded()
+{
+	const double LoadMs = (FPlatformTime::Seconds() - MeshLoadRequestTime) * 1000.0;
+	UE_LOG(LogSkullyMovement, Log, TEXT("[Assets] Skully 메시 로드 완료: %.1f ms (Bone %s, Clay %s)"), LoadMs,
+		BoneMeshAsset.IsValid() ? TEXT("OK") : TEXT("실패"), ClayMeshAsset.IsValid() ? TEXT("OK") : TEXT("실패"));
+	
+	ApplyMeshAssets();
+	MeshLoadHandle.Reset();
+	
+	// 플레이스홀더 스케일 기준으로 잡힌 보간/구르기 비주얼의 기준 트랜스폼(회전 기준점)을 실제 메시 기준으로 다시 잡음
+	MovementComponent->SetInterpolatedVisualComponents({ Skully_Bone, Skully_Clay });
+}
+
+void ASkully::ApplyMeshAssets()
+{
+	if (USkeletalMesh* BoneMesh = BoneMeshAsset.Get())
+	{
+		Skully_Bone->SetSkeletalMesh(BoneMesh);
+	}
+	
+	if (UStaticMesh* ClayMesh = ClayMeshAsset.Get())
+	{
+		Skully_Clay->SetStaticMesh(ClayMesh);
+		
+		// 플레이스홀더 스케일만 되돌림(지정한 스케일은 그대로)
+		if (bClayPlaceholderShown == true)
+		{
+			Skully_Clay->SetRelativeScale3D(ClayAuthoredScale);
+			bClayPlaceholderShown = false;
+		}
+	}
+}
@@ -0,0 +1,322 @@
+/*
+ * 파일명: SkullyAsyncMovementSubsystem.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 구 이동을 Chaos 비동기 물리(물리 스레드 고정 틱 콜백)에서 적분하고 게임 스레드에서 결과를 보간하는 월드 서브시스템
+ */
+
+#include "Skully/SkullyAsyncMovementSubsystem.h"
+
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Engine/World.h"
+#include "MySkully.h"
+#include "PBDRigidsSolver.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "Physics/GenericPhysicsInterface.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "Skully/SkullyMovementStats.h"
+
+// 게임 스레드 -> 물리 스레드: 바디 하나의 이번 프레임 입력
+struct FSkullyAsyncBodyInput
+{
+	int32 BodyId = INDEX_NONE;
+	float Radius = 0.0f;
+	FCollisionQueryParams QueryParams;
+	FVector Input = FVector::ZeroVector;
+	FSkullyMovementModelParams Params;
+	uint32 TeleportGeneration = 0;
+	FSkullyKernelBodyState TeleportState;
+};
+
+struct FSkullyAsyncMovementInput : public Chaos::FSimCallbackInput
+{
+	// 등록된 전체 바디(목록에 없는 바디는 물리 스레드에서 제거)
+	TArray<FSkullyAsyncBodyInput> Bodies;
+
+	void Reset()
+	{
+		Bodies.Reset();
+	}
+};
+
+// 물리 스레드 -> 게임 스레드: 물리 스텝 하나의 결과
+struct FSkullyAsyncBodyOutput
+{
+	int32 BodyId = INDEX_NONE;
+	// 이 결과를 만든 상태의 순간이동 번호(게임 스레드가 그 뒤에 덮어썼으면 버림)
+	uint32 TeleportGeneration = 0;
+	FSkullyKernelBodyState State;
+};
+
+struct FSkullyAsyncMovementOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<FSkullyAsyncBodyOutput> Bodies;
+
+	void Reset()
+	{
+		Bodies.Reset();
+	}
+};
+
+// 물리 스텝 직전(Presimulate)에 실행되는 콜백, Bodies는 물리 스레드에서만 접근
+class FSkullyAsyncMovementCallback : public Chaos::TSimCallbackObject<FSkullyAsyncMovementInput, FSkullyAsyncMovementOutput, Chaos::ESimCallbackOptions::Presimulate>
+{
+public:
+	// 물리 스레드 씬 쿼리용(콜백은 월드보다 먼저 해제됨)
+	const UWorld* World = nullptr;
+
+private:
+	virtual void OnPreSimulate_Internal() override;
+
+	struct FBody
+	{
+		FSkullyKernelBodyState State;
+		uint32 TeleportGeneration = 0;
+	};
+
+	TMap<int32, FBody> Bodies;
+};
+
+void FSkullyAsyncMovementCallback::OnPreSimulate_Internal()
+{
+	const FSkullyAsyncMovementInput* Input = GetConsumerInput_Internal();
+	if (Input == nullptr || World == nullptr)
+	{
+		return;
+	}
+
+	const float DeltaTime = static_cast<float>(GetDeltaTime_Internal());
+	if (DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// 입력에 없는 바디 제거
+	for (auto It = Bodies.CreateIterator(); It; ++It)
+	{
+		const int32 BodyId = It.Key();
+		if (Input->Bodies.ContainsByPredicate([BodyId](const FSkullyAsyncBodyInput& BodyInput) { return BodyInput.BodyId == BodyId; }) == false)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	FSkullyAsyncMovementOutput& Output = GetProducerOutputData_Internal();
+	Output.Bodies.Reset(Input->Bodies.Num());
+
+	for (const FSkullyAsyncBodyInput& BodyInput : Input->Bodies)
+	{
+		// 새 바디이거나 게임 스레드가 상태를 덮어썼으면 그 상태에서 시작
+		FBody* Body = Bodies.Find(BodyInput.BodyId);
+		if (Body == nullptr || Body->TeleportGeneration != BodyInput.TeleportGeneration)
+		{
+			Body = &Bodies.Add(BodyInput.BodyId);
+			Body->State = BodyInput.TeleportState;
+			Body->TeleportGeneration = BodyInput.TeleportGeneration;
+		}
+
+		FSkullyKernelBodyState& State = Body->State;
+		const FSkullyMovementModelParams& Params = BodyInput.Params;
+
+		FVector MoveDelta;
+		SkullyMovementKernel::StepVelocity(State.Velocity, State.bIsSlopeSliding, State.CachedFloorNormal, State.LastFloorNormal,
+			BodyInput.Input, State.bGrounded, Params, DeltaTime, MoveDelta);
+
+		// 물리 스레드 가속 구조에 대한 Sweep(게임 스레드 UWorld 쿼리는 사용할 수 없음)
+		SkullyMovementKernel::MoveSphere(State, MoveDelta, BodyInput.Radius, Params, DeltaTime,
+			[this, &BodyInput](FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel)
+			{
+				TArray<FHitResult> Hits;
+				FGenericPhysicsInterface_Internal::SpherecastMulti(World, BodyInput.Radius, Start, End, Channel, BodyInput.QueryParams,
+					FCollisionResponseParams::DefaultResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, Hits);
+
+				// 멀티 스윕은 막는 히트가 있으면 마지막 원소
+				if (Hits.Num() > 0 && Hits.Last().bBlockingHit == true)
+				{
+					OutHit = Hits.Last();
+					return true;
+				}
+
+				return false;
+			});
+
+		Output.Bodies.Add({ BodyInput.BodyId, Body->TeleportGeneration, State });
+	}
+}
+
+void USkullyAsyncMovementSubsystem::Deinitialize()
+{
+	if (Callback != nullptr)
+	{
+		if (FPhysScene* PhysScene = GetWorld()->GetPhysicsScene())
+		{
+			PhysScene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(Callback);
+		}
+		Callback = nullptr;
+	}
+	Bodies.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId USkullyAsyncMovementSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkullyAsyncMovementSubsystem, STATGROUP_Tickables);
+}
+
+void USkullyAsyncMovementSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Callback == nullptr)
+	{
+		return;
+	}
+
+	// 컴포넌트가 읽지 않은 프레임에도 결과가 쌓이지 않도록 소비
+	ConsumeOutputs();
+	// 모든 액터 Tick 이후이므로 이번 프레임에 모인 입력을 한 번에 전달
+	PushInputs();
+}
+
+bool USkullyAsyncMovementSubsystem::EnsureCallback()
+{
+	if (Callback != nullptr)
+	{
+		return true;
+	}
+
+	FPhysScene* PhysScene = GetWorld()->GetPhysicsScene();
+	if (PhysScene == nullptr || PhysScene->GetSolver() == nullptr)
+	{
+		return false;
+	}
+
+	Callback = PhysScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FSkullyAsyncMovementCallback>();
+	Callback->World = GetWorld();
+
+	if (UPhysicsSettings::Get()->bTickPhysicsAsync == false)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Async] 비동기 물리가 꺼져 있어 물리 스텝(프레임 간격)마다 게임 스레드에서 이동합니다. 프로젝트 설정의 Tick Physics Async를 켜 주세요."));
+	}
+
+	return true;
+}
+
+int32 USkullyAsyncMovementSubsystem::AddBody(const FSkullyKernelBodyState& State, float Radius, const FCollisionQueryParams& QueryParams)
+{
+	if (EnsureCallback() == false)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 BodyId = NextBodyId++;
+	FAsyncBody& Body = Bodies.Add(BodyId);
+	Body.Radius = Radius;
+	Body.QueryParams = QueryParams;
+	Body.TeleportState = State;
+	Body.PrevState = State;
+	Body.LatestState = State;
+
+	return BodyId;
+}
+
+void USkullyAsyncMovementSubsystem::RemoveBody(int32 BodyId)
+{
+	Bodies.Remove(BodyId);
+}
+
+void USkullyAsyncMovementSubsystem::SetBodyInput(int32 BodyId, const FVector& Input, const FSkullyMovementModelParams& Params)
+{
+	if (FAsyncBody* Body = Bodies.Find(BodyId))
+	{
+		Body->Input = Input;
+		Body->Params = Params;
+	}
+}
+
+void USkullyAsyncMovementSubsystem::TeleportBody(int32 BodyId, const FSkullyKernelBodyState& State)
+{
+	if (FAsyncBody* Body = Bodies.Find(BodyId))
+	{
+		++Body->TeleportGeneration;
+		Body->TeleportState = State;
+		Body->PrevState = State;
+		Body->LatestState = State;
+	}
+}
+
+bool USkullyAsyncMovementSubsystem::GetBodyState(int32 BodyId, FSkullyKernelBodyState& OutState)
+{
+	ConsumeOutputs();
+
+	const FAsyncBody* Body = Bodies.Find(BodyId);
+	if (Body == nullptr || Body->bHasOutput == false)
+	{
+		return false;
+	}
+
+	// 마지막 결과를 받은 뒤 지난 시간만큼 이전 결과 -> 마지막 결과로 보간(물리 스텝 하나 뒤를 표시)
+	const double StepTime = LatestOutputTime - PrevOutputTime;
+	const float Alpha = StepTime > 0.0 ? static_cast<float>(FMath::Clamp((GetWorld()->GetTimeSeconds() - LatestOutputArrivalTime) / StepTime, 0.0, 1.0)) : 1.0f;
+
+	OutState = Body->LatestState;
+	OutState.Position = FMath::Lerp(Body->PrevState.Position, Body->LatestState.Position, Alpha);
+
+	return true;
+}
+
+void USkullyAsyncMovementSubsystem::PushInputs()
+{
+	if (Bodies.Num() == 0)
+	{
+		return;
+	}
+
+	FSkullyAsyncMovementInput* Input = Callback->GetProducerInputData_External();
+	Input->Bodies.Reset(Bodies.Num());
+	for (const TPair<int32, FAsyncBody>& Pair : Bodies)
+	{
+		const FAsyncBody& Body = Pair.Value;
+
+		FSkullyAsyncBodyInput& BodyInput = Input->Bodies.AddDefaulted_GetRef();
+		BodyInput.BodyId = Pair.Key;
+		BodyInput.Radius = Body.Radius;
+		BodyInput.QueryParams = Body.QueryParams;
+		BodyInput.Input = Body.Input;
+		BodyInput.Params = Body.Params;
+		BodyInput.TeleportGeneration = Body.TeleportGeneration;
+		BodyInput.TeleportState = Body.TeleportState;
+	}
+}
+
+void USkullyAsyncMovementSubsystem::ConsumeOutputs()
+{
+	if (Callback == nullptr || LastConsumedFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastConsumedFrame = GFrameCounter;
+
+	while (Chaos::TSimCallbackOutputHandle<FSkullyAsyncMovementOutput> Output = Callback->PopOutputData_External())
+	{
+		PrevOutputTime = LatestOutputTime;
+		LatestOutputTime = Output->InternalTime;
+		LatestOutputArrivalTime = GetWorld()->GetTimeSeconds();
+
+		for (const FSkullyAsyncBodyOutput& BodyOutput : Output->Bodies)
+		{
+			if (FAsyncBody* Body = Bodies.Find(BodyOutput.BodyId))
+			{
+				// 순간이동 이전 상태에서 나온 결과는 버림
+				if (BodyOutput.TeleportGeneration == Body->TeleportGeneration)
+				{
+					Body->PrevState = Body->bHasOutput ? Body->LatestState : BodyOutput.State;
+					Body->LatestState = BodyOutput.State;
+					Body->bHasOutput = true;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,239 @@
+/*
+ * 파일명: SkullyBodyBatchSubsystem.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 다수의 구형 바디(굴러다니는 해골 소품/NPC)를 SoA 배열로 보관하고 한 번의 병렬 패스로 이동시키는 배치 시뮬레이터
+ */
+
+#include "Skully/SkullyBodyBatchSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Skully/SkullyMovementComponent.h"
+#include "Skully/SkullyMovementKernel.h"
+#include "Skully/SkullyMovementStats.h"
+
+void USkullyBodyBatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 플레이어 Skully와 같은 튜닝 값으로 시작
+	ModelParams = GetDefault<USkullyMovementComponent>()->MakeModelParams();
+}
+
+TStatId USkullyBodyBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkullyBodyBatchSubsystem, STATGROUP_Tickables);
+}
+
+void USkullyBodyBatchSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bAutoStep == false || Positions.Num() == 0)
+	{
+		return;
+	}
+
+	// USkullyMovementComponent의 고정 스텝과 같은 방식: 처리할 수 없는 시간은 버린다
+	const float Step = FMath::Max(FixedTimestep, KINDA_SMALL_NUMBER);
+	const int32 MaxSteps = FMath::Max(MaxStepsPerFrame, 1);
+	TimeAccumulator = FMath::Min(TimeAccumulator + DeltaTime, Step * MaxSteps);
+
+	while (TimeAccumulator >= Step)
+	{
+		StepBodies(Step);
+		TimeAccumulator -= Step;
+	}
+}
+
+int32 USkullyBodyBatchSubsystem::AddBody(const FVector& Location, float Radius, const FVector& InitialVelocity)
+{
+	const int32 Index = Positions.Add(Location);
+	Velocities.Add(InitialVelocity);
+	CachedFloorNormals.Add(FVector::UpVector);
+	LastFloorNormals.Add(FVector::UpVector);
+	GroundedFlags.Add(0);
+	SlideFlags.Add(0);
+	Inputs.Add(FVector::ZeroVector);
+	Radii.Add(FMath::Max(Radius, 1.0f));
+
+	return AllocateBodyId(Index);
+}
+
+int32 USkullyBodyBatchSubsystem::AllocateBodyId(int32 Index)
+{
+	const int32 BodyId = FreeBodyIds.Num() > 0 ? FreeBodyIds.Pop(EAllowShrinking::No) : BodyIdToIndex.AddUninitialized();
+	BodyIdToIndex[BodyId] = Index;
+	IndexToBodyId.Add(BodyId);
+
+	return BodyId;
+}
+
+void USkullyBodyBatchSubsystem::RemoveBody(int32 BodyId)
+{
+	if (BodyIdToIndex.IsValidIndex(BodyId) == false || BodyIdToIndex[BodyId] == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 Index = BodyIdToIndex[BodyId];
+	const int32 LastIndex = Positions.Num() - 1;
+
+	// 마지막 바디가 빈 자리로 옮겨오므로 그 바디의 ID -> 인덱스를 갱신
+	BodyIdToIndex[IndexToBodyId[LastIndex]] = Index;
+	BodyIdToIndex[BodyId] = INDEX_NONE;
+	FreeBodyIds.Add(BodyId);
+
+	Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	CachedFloorNormals.RemoveAtSwap(Index, EAllowShrinking::No);
+	LastFloorNormals.RemoveAtSwap(Index, EAllowShrinking::No);
+	GroundedFlags.RemoveAtSwap(Index, EAllowShrinking::No);
+	SlideFlags.RemoveAtSwap(Index, EAllowShrinking::No);
+	Inputs.RemoveAtSwap(Index, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, EAllowShrinking::No);
+	IndexToBodyId.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void USkullyBodyBatchSubsystem::RemoveAllBodies()
+{
+	Positions.Reset();
+	Velocities.Reset();
+	CachedFloorNormals.Reset();
+	LastFloorNormals.Reset();
+	GroundedFlags.Reset();
+	SlideFlags.Reset();
+	Inputs.Reset();
+	Radii.Reset();
+	IndexToBodyId.Reset();
+	BodyIdToIndex.Reset();
+	FreeBodyIds.Reset();
+	TimeAccumulator = 0.0f;
+}
+
+void USkullyBodyBatchSubsystem::SetBodyInput(int32 BodyId, const FVector& WorldInput)
+{
+	if (BodyIdToIndex.IsValidIndex(BodyId) == true && BodyIdToIndex[BodyId] != INDEX_NONE)
+	{
+		Inputs[BodyIdToIndex[BodyId]] = WorldInput.IsNearlyZero() ? FVector::ZeroVector : WorldInput.GetClampedToMaxSize(1.0f);
+	}
+}
+
+bool USkullyBodyBatchSubsystem::GetBodyLocation(int32 BodyId, FVector& OutLocation) const
+{
+	if (BodyIdToIndex.IsValidIndex(BodyId) == false || BodyIdToIndex[BodyId] == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLocation = Positions[BodyIdToIndex[BodyId]];
+	return true;
+}
+
+void USkullyBodyBatchSubsystem::StepBodies(float DeltaTime)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyBodyBatchStep, SkullyMovement_BodyBatchStep);
+
+	const int32 NumBodies = Positions.Num();
+	if (NumBodies == 0 || DeltaTime <= 0.0f || GetWorld() == nullptr)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_SkullyBatchBodySteps, NumBodies);
+
+	// 스텝 동안 월드 지오메트리는 바뀌지 않으므로(게임 스레드가 이 호출에서 대기) 씬 쿼리는 읽기 전용으로 병렬 수행
+	if (bUseSimdKernel == true)
+	{
+		// 속도 단계는 바디 4개씩 SIMD 커널로 묶어서 처리
+		const int32 Width = FSkullyMovementKernelLanes::Width;
+		const int32 NumGroups = FMath::DivideAndRoundUp(NumBodies, Width);
+		ParallelFor(TEXT("SkullyBodyBatchStep"), NumGroups, FMath::Max(MinBodiesPerTask / Width, 1), [this, DeltaTime, Width](int32 Group)
+		{
+			StepBodyGroup(Group * Width, DeltaTime);
+		});
+	}
+	else
+	{
+		ParallelFor(TEXT("SkullyBodyBatchStep"), NumBodies, FMath::Max(MinBodiesPerTask, 1), [this, DeltaTime](int32 Index)
+		{
+			StepBody(Index, DeltaTime);
+		});
+	}
+}
+
+void USkullyBodyBatchSubsystem::StepBody(int32 Index, float DeltaTime)
+{
+	const FSkullyMovementModelParams& Params = ModelParams;
+
+	FVector& Velocity = Velocities[Index];
+	const FVector& CachedFloorNormal = CachedFloorNormals[Index];
+	const FVector& LastFloorNormal = LastFloorNormals[Index];
+	const bool bGrounded = GroundedFlags[Index] != 0;
+	bool bIsSlopeSliding = SlideFlags[Index] != 0;
+
+	// 속도 단계(중력 -> 경사 미끄러짐 -> 마찰 -> 입력 가속)
+	FVector MoveDelta;
+	SkullyMovementKernel::StepVelocity(Velocity, bIsSlopeSliding, CachedFloorNormal, LastFloorNormal, Inputs[Index], bGrounded, Params, DeltaTime, MoveDelta);
+	SlideFlags[Index] = bIsSlopeSliding ? 1 : 0;
+
+	MoveBody(Index, MoveDelta, DeltaTime);
+}
+
+void USkullyBodyBatchSubsystem::StepBodyGroup(int32 FirstIndex, float DeltaTime)
+{
+	const int32 NumLanes = FMath::Min(FSkullyMovementKernelLanes::Width, Positions.Num() - FirstIndex);
+
+	FSkullyMovementKernelLanes Lanes;
+	for (int32 Lane = 0; Lane < FSkullyMovementKernelLanes::Width; ++Lane)
+	{
+		const int32 Index = FirstIndex + Lane;
+		if (Lane < NumLanes)
+		{
+			Lanes.SetLane(Lane, Velocities[Index], CachedFloorNormals[Index], LastFloorNormals[Index], Inputs[Index], GroundedFlags[Index] != 0, SlideFlags[Index] != 0);
+		}
+		else
+		{
+			Lanes.ClearLane(Lane);
+		}
+	}
+
+	SkullyMovementKernel::StepVelocitiesSimd(Lanes, ModelParams, DeltaTime);
+
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		const int32 Index = FirstIndex + Lane;
+		Velocities[Index] = Lanes.GetVelocity(Lane);
+		SlideFlags[Index] = Lanes.IsSliding(Lane) ? 1 : 0;
+
+		MoveBody(Index, Lanes.GetMoveDelta(Lane), DeltaTime);
+	}
+}
+
+void USkullyBodyBatchSubsystem::MoveBody(int32 Index, const FVector& MoveDelta, float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	const FCollisionShape Shape = FCollisionShape::MakeSphere(Radii[Index]);
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SkullyBodyBatch), false);
+
+	FSkullyKernelBodyState Body;
+	Body.Position = Positions[Index];
+	Body.Velocity = Velocities[Index];
+	Body.CachedFloorNormal = CachedFloorNormals[Index];
+	Body.LastFloorNormal = LastFloorNormals[Index];
+	Body.bGrounded = GroundedFlags[Index] != 0;
+	Body.bIsSlopeSliding = SlideFlags[Index] != 0;
+
+	SkullyMovementKernel::MoveSphere(Body, MoveDelta, Radii[Index], ModelParams, DeltaTime,
+		[World, &Shape, &QueryParams](FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel)
+		{
+			return World->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, Channel, Shape, QueryParams);
+		});
+
+	Positions[Index] = Body.Position;
+	CachedFloorNormals[Index] = Body.CachedFloorNormal;
+	LastFloorNormals[Index] = Body.LastFloorNormal;
+	GroundedFlags[Index] = Body.bGrounded ? 1 : 0;
+	SlideFlags[Index] = Body.bIsSlopeSliding ? 1 : 0;
+}
@@ -0,0 +1,208 @@
+/*
+ * 파일명: SkullyDownhillSampler.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 주변 바닥 높이를 샘플링해서 downhill 방향을 추정하는 샘플러(동기/비동기 배치)
+ */
+
+#include "Skully/SkullyDownhillSampler.h"
+
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+#include "Skully/SkullyMovementStats.h"
+
+void FSkullyDownhillSampler::SampleSync(UWorld* World, const FSkullyDownhillSampleParams& Params, FSkullyDownhillSampleResult& OutResult)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SkullyMovement_DownhillSampleSync);
+	
+	OutResult = FSkullyDownhillSampleResult();
+	
+	if (World == nullptr || Params.SampleDistance <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+	
+	const FCollisionQueryParams QueryParams = MakeQueryParams(Params);
+	
+	// 기준 높이
+	float BestZ = Params.Origin.Z;
+	FVector BestDir = FVector::ZeroVector;
+	bool bAllStatic = true;
+	
+	const TArray<FVector>& Dirs = GetSampleDirections(Params.NumDirections);
+	INC_DWORD_STAT_BY(STAT_SkullyGroundLineTraces, Dirs.Num());
+	SkullyCountGroundProbe(Params.bTraceComplex, Dirs.Num());
+	OutResult.NumTracesIssued = Dirs.Num();
+	
+	for (const FVector& Dir : Dirs)
+	{
+		const FVector SampleStart = Params.Origin + Dir * Params.SampleDistance;
+		const FVector SampleEnd = SampleStart - FVector::UpVector * Params.TraceDown;
+		
+		FHitResult Hit;
+		const bool bHit = World->LineTraceSingleByChannel(Hit, SampleStart, SampleEnd, ECC_Visibility, QueryParams) && Hit.bBlockingHit == true;
+		AccumulateSample(Dir, bHit ? &Hit : nullptr, BestZ, BestDir, bAllStatic);
+	}
+	
+	OutResult.bAllStatic = bAllStatic;
+	
+	// 충분히 아래가 아니면 무시
+	if (BestDir.IsNearlyZero() == false)
+	{
+		OutResult.bFound = true;
+		OutResult.Dir = BestDir.GetSafeNormal();
+	}
+}
+
+bool FSkullyDownhillSampler::SampleAsync(UWorld* World, const FSkullyDownhillSampleParams& Params, float ReuseDistance, FSkullyDownhillSampleResult& OutResult)
+{
+	OutResult = FSkullyDownhillSampleResult();
+	
+	if (World == nullptr || Params.SampleDistance <= KINDA_SMALL_NUMBER)
+	{
+		// 샘플할 수 없는 조건은 결과가 나온 것(찾지 못함)으로 취급
+		return true;
+	}
+	
+	if (PendingTraces.Num() > 0)
+	{
+		// 다른 방향 수로 요청했거나 기준 위치에서 너무 멀어졌으면 결과를 쓸 수 없음
+		bool bUsable = PendingNumDirections == Params.NumDirections && 
+			FVector::DistSquared(PendingOrigin, Params.Origin) <= FMath::Square(ReuseDistance);
+		
+		// 결과 보관 기간(다음 한 프레임)이 지난 핸들은 더 이상 조회할 수 없음
+		for (const FTraceHandle& Handle : PendingTraces)
+		{
+			bUsable &= World->IsTraceHandleValid(Handle, false);
+		}
+		
+		if (bUsable == false)
+		{
+			Reset();
+		}
+		else
+		{
+			const TArray<FVector>& Dirs = GetSampleDirections(PendingNumDirections);
+			
+			float BestZ = PendingOrigin.Z;
+			FVector BestDir = FVector::ZeroVector;
+			bool bAllStatic = true;
+			
+			for (int32 Index = 0; Index < PendingTraces.Num(); ++Index)
+			{
+				FTraceDatum Datum;
+				if (World->QueryTraceData(PendingTraces[Index], Datum) == false)
+				{
+					// 아직 완료되지 않음: 배치를 유지하고 다음 틱에 다시 확인
+					return false;
+				}
+				
+				const FHitResult* Hit = (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit == true) ? &Datum.OutHits[0] : nullptr;
+				AccumulateSample(Dirs[Index], Hit, BestZ, BestDir, bAllStatic);
+			}
+			
+			Reset();
+			
+			OutResult.bAllStatic = bAllStatic;
+			if (BestDir.IsNearlyZero() == false)
+			{
+				OutResult.bFound = true;
+				OutResult.Dir = BestDir.GetSafeNormal();
+			}
+			
+			return true;
+		}
+	}
+	
+	OutResult.NumTracesIssued = RequestAsync(World, Params);
+	
+	return false;
+}
+
+void FSkullyDownhillSampler::Reset()
+{
+	PendingTraces.Reset();
+	PendingNumDirections = 0;
+}
+
+int32 FSkullyDownhillSampler::RequestAsync(UWorld* World, const FSkullyDownhillSampleParams& Params)
+{
+	const FCollisionQueryParams QueryParams = MakeQueryParams(Params);
+	const TArray<FVector>& Dirs = GetSampleDirections(Params.NumDirections);
+	
+	PendingTraces.Reset(Dirs.Num());
+	PendingNumDirections = Params.NumDirections;
+	PendingOrigin = Params.Origin;
+	
+	INC_DWORD_STAT_BY(STAT_SkullyGroundLineTraces, Dirs.Num());
+	SkullyCountGroundProbe(Params.bTraceComplex, Dirs.Num());
+	
+	// 모든 방향을 한 번에 요청: 실제 트레이스는 워커 스레드에서 처리되고 결과는 다음 프레임에 조회
+	for (const FVector& Dir : Dirs)
+	{
+		const FVector SampleStart = Params.Origin + Dir * Params.SampleDistance;
+		const FVector SampleEnd = SampleStart - FVector::UpVector * Params.TraceDown;
+		
+		PendingTraces.Add(World->AsyncLineTraceByChannel(EAsyncTraceType::Single, SampleStart, SampleEnd, ECC_Visibility, QueryParams));
+	}
+	
+	return Dirs.Num();
+}
+
+const TArray<FVector>& FSkullyDownhillSampler::GetSampleDirections(int32 NumDirections)
+{
+	// 4방향은 기존 순서(앞, 오른쪽, 뒤, 왼쪽)와 동일하게 0도부터 반시계 방향으로 균등 분할
+	auto MakeDirections = [](int32 Num)
+	{
+		TArray<FVector> Dirs;
+		Dirs.Reserve(Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const float Angle = 2.0f * PI * Index / Num;
+			Dirs.Add(FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f));
+		}
+		return Dirs;
+	};
+	
+	static const TArray<FVector> Dirs4 = MakeDirections(4);
+	static const TArray<FVector> Dirs8 = MakeDirections(8);
+	static const TArray<FVector> Dirs16 = MakeDirections(16);
+	
+	if (NumDirections >= 16)
+	{
+		return Dirs16;
+	}
+	
+	return NumDirections >= 8 ? Dirs8 : Dirs4;
+}
+
+FCollisionQueryParams FSkullyDownhillSampler::MakeQueryParams(const FSkullyDownhillSampleParams& Params)
+{
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SkullyDownhillSample), Params.bTraceComplex);
+	if (Params.IgnoreActor != nullptr)
+	{
+		QueryParams.AddIgnoredActor(Params.IgnoreActor);
+	}
+	
+	return QueryParams;
+}
+
+void FSkullyDownhillSampler::AccumulateSample(const FVector& Dir, const FHitResult* Hit, float& InOutBestZ, FVector& InOutBestDir, bool& InOutAllStatic)
+{
+	if (Hit == nullptr)
+	{
+		// 아무것도 맞지 않은 샘플은 나중에 생길 수 있으므로 재사용하지 않는다
+		InOutAllStatic = false;
+		return;
+	}
+	
+	const UPrimitiveComponent* HitComponent = Hit->GetComponent();
+	InOutAllStatic &= HitComponent != nullptr && HitComponent->Mobility == EComponentMobility::Static;
+	
+	const float Z = Hit->ImpactPoint.Z;
+	if (Z < InOutBestZ)
+	{
+		InOutBestZ = Z;
+		InOutBestDir = Dir;
+	}
+}
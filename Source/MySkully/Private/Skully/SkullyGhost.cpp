@@ -0,0 +1,138 @@
+/*
+ * 파일명: SkullyGhost.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 녹화된 고스트 궤적을 스트리밍으로 읽어 따라 움직이는 고스트 액터(충돌 없음)
+ */
+
+#include "Skully/SkullyGhost.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "MySkully.h"
+#include "Skully/SkullyMovementComponent.h"
+#include "UObject/ConstructorHelpers.h"
+
+ASkullyGhost::ASkullyGhost()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	GhostMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("GhostMesh"));
+	GhostMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	GhostMesh->SetGenerateOverlapEvents(false);
+	GhostMesh->SetCanEverAffectNavigation(false);
+	GhostMesh->SetCastShadow(false);
+	RootComponent = GhostMesh;
+
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> GhostSphere(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	if (GhostSphere.Succeeded() == true)
+	{
+		GhostMesh->SetStaticMesh(GhostSphere.Object);
+	}
+}
+
+void ASkullyGhost::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Reader.Close();
+	bPlaying = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool ASkullyGhost::StartPlayback(const FString& NameOrPath)
+{
+	StopPlayback();
+
+	const FString FilePath = FSkullyGhostWriter::ResolveFilePath(NameOrPath);
+	if (Reader.Open(FilePath) == false || Reader.ReadKey(PrevKey) == false)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Ghost] 궤적을 읽지 못함: %s"), *FilePath);
+		Reader.Close();
+		return false;
+	}
+	bHasNextKey = Reader.ReadKey(NextKey);
+
+	if (bScaleMeshToBodyRadius == true && Reader.GetBodyRadius() > 0.0f)
+	{
+		GhostMesh->SetRelativeScale3D(FVector(Reader.GetBodyRadius() / 50.0f));
+	}
+
+	PlaybackTime = PrevKey.Tick / Reader.GetSampleRate();
+	RollRotation = FQuat::Identity;
+	SetActorLocationAndRotation(PrevKey.Location, RollRotation);
+
+	bPlaying = true;
+	SetActorTickEnabled(true);
+
+	return true;
+}
+
+void ASkullyGhost::StopPlayback()
+{
+	Reader.Close();
+	bHasNextKey = false;
+	bPlaying = false;
+	SetActorTickEnabled(false);
+}
+
+bool ASkullyGhost::IsGhostGrounded() const
+{
+	return GetMovementMode() == ESkullyMovementMode::Grounded;
+}
+
+ESkullyMovementMode ASkullyGhost::GetMovementMode() const
+{
+	return static_cast<ESkullyMovementMode>(PrevKey.Mode);
+}
+
+void ASkullyGhost::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bPlaying == false)
+	{
+		return;
+	}
+
+	PlaybackTime += DeltaTime;
+	const double Tick = PlaybackTime * Reader.GetSampleRate();
+
+	// 지난 키는 버리고 다음 키를 필요한 만큼만 디코드
+	while (bHasNextKey == true && NextKey.Tick <= Tick)
+	{
+		PrevKey = NextKey;
+		bHasNextKey = Reader.ReadKey(NextKey);
+	}
+
+	if (bHasNextKey == false)
+	{
+		MoveGhostTo(PrevKey.Location);
+		FinishPlayback();
+		return;
+	}
+
+	const float Alpha = FMath::Clamp(static_cast<float>((Tick - PrevKey.Tick) / (NextKey.Tick - PrevKey.Tick)), 0.0f, 1.0f);
+	MoveGhostTo(FMath::Lerp(PrevKey.Location, NextKey.Location, Alpha));
+}
+
+void ASkullyGhost::MoveGhostTo(const FVector& NewLocation)
+{
+	const FVector Delta2D(NewLocation.X - GetActorLocation().X, NewLocation.Y - GetActorLocation().Y, 0.0f);
+	const float Distance2D = Delta2D.Size();
+	// 메시 스케일을 반지름에 맞추지 않았으면 엔진 기본 구 반지름 기준
+	const float Radius = GhostMesh->GetRelativeScale3D().X * 50.0f;
+	if (bRollMesh == true && Distance2D > KINDA_SMALL_NUMBER && Radius > KINDA_SMALL_NUMBER)
+	{
+		const FVector Axis = FVector::CrossProduct(FVector::UpVector, Delta2D / Distance2D);
+		RollRotation = (FQuat(Axis, Distance2D / Radius) * RollRotation).GetNormalized();
+	}
+
+	SetActorLocationAndRotation(NewLocation, RollRotation);
+}
+
+void ASkullyGhost::FinishPlayback()
+{
+	StopPlayback();
+	OnPlaybackFinished();
+}
@@ -0,0 +1,242 @@
+/*
+ * 파일명: SkullyGhostSubsystem.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 타임 트라이얼 고스트 레이스 녹화(고정 주기 샘플링 -> 궤적 파일 스트리밍 쓰기)와 고스트 액터 생성/관리 월드 서브시스템
+ */
+
+#include "Skully/SkullyGhostSubsystem.h"
+
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "MySkully.h"
+#include "Skully/SkullyGhost.h"
+#include "Skully/SkullyMovementComponent.h"
+
+namespace
+{
+	TAutoConsoleVariable<float> CVarGhostSampleRate(
+		TEXT("Skully.Ghost.SampleRate"),
+		30.0f,
+		TEXT("고스트 녹화 초당 샘플 수(녹화 시작 시 적용)"));
+
+	TAutoConsoleVariable<float> CVarGhostPositionTolerance(
+		TEXT("Skully.Ghost.PositionTolerance"),
+		1.0f,
+		TEXT("키 축약 위치 허용 오차(cm), 늘리면 파일이 작아지지만 고스트 경로가 덜 정확함"));
+
+	TAutoConsoleVariable<int32> CVarGhostMaxGhosts(
+		TEXT("Skully.Ghost.MaxGhosts"),
+		8,
+		TEXT("동시에 띄울 수 있는 고스트 수"));
+
+	// 비교 기준: 샘플마다 float 시간 + 위치(FVector3f) + 이동 모드 1바이트
+	constexpr int32 RawSampleBytes = 4 + 12 + 1;
+}
+
+void USkullyGhostSubsystem::Deinitialize()
+{
+	StopRecording();
+	ClearGhosts();
+
+	Super::Deinitialize();
+}
+
+TStatId USkullyGhostSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkullyGhostSubsystem, STATGROUP_Tickables);
+}
+
+void USkullyGhostSubsystem::Tick(float DeltaTime)
+{
+	if (Writer.IsOpen() == false)
+	{
+		return;
+	}
+
+	if (RecordedBody.IsValid() == false || RecordedBody->UpdatedComponent == nullptr)
+	{
+		StopRecording();
+		return;
+	}
+
+	// 고정 주기 샘플링(프레임이 샘플 주기보다 길면 건너뛴 샘플은 재생 시 보간)
+	RecordTime += DeltaTime;
+	const int32 SampleTick = FMath::FloorToInt32(RecordTime * Writer.GetSampleRate());
+	if (SampleTick > LastSampleTick)
+	{
+		RecordSample(SampleTick);
+	}
+}
+
+bool USkullyGhostSubsystem::StartRecording(USkullyMovementComponent* Body, const FString& NameOrPath)
+{
+	StopRecording();
+
+	if (Body == nullptr || Body->UpdatedComponent == nullptr)
+	{
+		return false;
+	}
+
+	const USphereComponent* Sphere = Cast<USphereComponent>(Body->UpdatedComponent);
+	RecordingPath = FSkullyGhostWriter::ResolveFilePath(NameOrPath);
+	if (Writer.Open(RecordingPath, CVarGhostSampleRate.GetValueOnGameThread(), Sphere != nullptr ? Sphere->GetScaledSphereRadius() : 0.0f,
+		CVarGhostPositionTolerance.GetValueOnGameThread()) == false)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Ghost] 녹화 파일을 열지 못함: %s"), *RecordingPath);
+		return false;
+	}
+
+	RecordedBody = Body;
+	RecordTime = 0.0;
+	LastSampleTick = INDEX_NONE;
+	RecordSample(0);
+
+	return true;
+}
+
+bool USkullyGhostSubsystem::StopRecording()
+{
+	if (Writer.IsOpen() == false)
+	{
+		return false;
+	}
+
+	// 마지막 위치까지 남도록 녹화 종료 시점 샘플 추가
+	if (RecordedBody.IsValid() == true && RecordedBody->UpdatedComponent != nullptr)
+	{
+		RecordSample(FMath::Max(LastSampleTick + 1, FMath::CeilToInt32(RecordTime * Writer.GetSampleRate())));
+	}
+	RecordedBody.Reset();
+
+	const int32 NumSamples = Writer.GetNumSamples();
+	const int32 NumKeys = Writer.GetNumKeys();
+	const bool bSaved = Writer.Close();
+	const int64 NumBytes = Writer.GetNumBytes();
+
+	UE_LOG(LogSkullyMovement, Log, TEXT("[Ghost] 녹화 저장 %s%s: %.2f초, 샘플 %d, 키 %d, %lld바이트(원본 대비 %.1f%%)"),
+		*RecordingPath, bSaved ? TEXT("") : TEXT(" (저장 실패)"), RecordTime, NumSamples, NumKeys, NumBytes,
+		NumSamples > 0 ? 100.0 * NumBytes / (static_cast<double>(NumSamples) * RawSampleBytes) : 0.0);
+
+	return bSaved;
+}
+
+void USkullyGhostSubsystem::RecordSample(int32 Tick)
+{
+	const USceneComponent* Updated = RecordedBody->UpdatedComponent;
+	Writer.AddSample(Tick, Updated->GetComponentLocation(), RecordedBody->GetMovementMode());
+	LastSampleTick = Tick;
+}
+
+ASkullyGhost* USkullyGhostSubsystem::SpawnGhost(const FString& NameOrPath, TSubclassOf<ASkullyGhost> GhostClass)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	ASkullyGhost* Ghost = World->SpawnActor<ASkullyGhost>(GhostClass != nullptr ? GhostClass.Get() : ASkullyGhost::StaticClass(), FTransform::Identity, SpawnParams);
+	if (Ghost == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (Ghost->StartPlayback(NameOrPath) == false)
+	{
+		Ghost->Destroy();
+		return nullptr;
+	}
+
+	// 상한을 넘으면 가장 먼저 띄운 고스트부터 제거
+	Ghosts.RemoveAll([](const TWeakObjectPtr<ASkullyGhost>& Existing) { return Existing.IsValid() == false; });
+	const int32 MaxGhosts = FMath::Max(CVarGhostMaxGhosts.GetValueOnGameThread(), 1);
+	while (Ghosts.Num() >= MaxGhosts)
+	{
+		if (ASkullyGhost* Oldest = Ghosts[0].Get())
+		{
+			Oldest->Destroy();
+		}
+		Ghosts.RemoveAt(0);
+	}
+	Ghosts.Add(Ghost);
+
+	return Ghost;
+}
+
+void USkullyGhostSubsystem::ClearGhosts()
+{
+	for (const TWeakObjectPtr<ASkullyGhost>& Ghost : Ghosts)
+	{
+		if (Ghost.IsValid() == true)
+		{
+			Ghost->Destroy();
+		}
+	}
+	Ghosts.Reset();
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	USkullyGhostSubsystem* GetGhostSubsystem(UWorld* World)
+	{
+		return World != nullptr ? World->GetSubsystem<USkullyGhostSubsystem>() : nullptr;
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs GhostRecordCommand(
+		TEXT("Skully.Ghost.Record"),
+		TEXT("플레이어 Skully의 고스트 궤적 녹화 시작: Skully.Ghost.Record [이름 또는 경로=LastGhost]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			USkullyGhostSubsystem* Ghosts = GetGhostSubsystem(World);
+			APawn* Pawn = World != nullptr ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+			if (Ghosts != nullptr && Pawn != nullptr)
+			{
+				Ghosts->StartRecording(Pawn->FindComponentByClass<USkullyMovementComponent>(), Args.Num() > 0 ? Args[0] : TEXT("LastGhost"));
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs GhostStopRecordCommand(
+		TEXT("Skully.Ghost.StopRecord"),
+		TEXT("고스트 궤적 녹화 종료 후 저장"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (USkullyGhostSubsystem* Ghosts = GetGhostSubsystem(World))
+			{
+				Ghosts->StopRecording();
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs GhostPlayCommand(
+		TEXT("Skully.Ghost.Play"),
+		TEXT("고스트 재생(여러 번 실행하면 고스트가 여러 개): Skully.Ghost.Play [이름 또는 경로=LastGhost]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (USkullyGhostSubsystem* Ghosts = GetGhostSubsystem(World))
+			{
+				Ghosts->SpawnGhost(Args.Num() > 0 ? Args[0] : TEXT("LastGhost"), nullptr);
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs GhostClearCommand(
+		TEXT("Skully.Ghost.Clear"),
+		TEXT("띄운 고스트 모두 제거"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (USkullyGhostSubsystem* Ghosts = GetGhostSubsystem(World))
+			{
+				Ghosts->ClearGhosts();
+			}
+		}));
+}
+
+#endif
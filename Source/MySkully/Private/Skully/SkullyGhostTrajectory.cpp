@@ -0,0 +1,375 @@
+/*
+ * 파일명: SkullyGhostTrajectory.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 고스트 레이스용 궤적 파일 형식(양자화 + 키 축약 + varint 델타 청크 스트림)과 스트리밍 쓰기/읽기
+ */
+
+#include "Skully/SkullyGhostTrajectory.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Skully/SkullyMovementComponent.h"
+
+namespace
+{
+	// 'SKGH'
+	constexpr uint32 GhostFileMagic = 0x48474B53;
+	// 2: 회전 채널 제거
+	constexpr uint32 GhostFileVersion = 2;
+
+	// 위치 양자화 단위(0.1cm)
+	constexpr float PositionQuantizeScale = 10.0f;
+
+	// 청크당 키 수(키 하나는 최대 36바이트이므로 청크 바이트 수는 uint16에 들어감)
+	constexpr int32 KeysPerChunk = 64;
+	// 키 없이 이어질 수 있는 최대 샘플 수(허용 오차 검사 비용과 보류 메모리 상한)
+	constexpr int32 MaxPendingSamples = 120;
+
+	void WriteVarint(TArray<uint8>& Buffer, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Buffer.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Buffer.Add(static_cast<uint8>(Value));
+	}
+
+	void WriteSignedVarint(TArray<uint8>& Buffer, int64 Value)
+	{
+		// zigzag: 0, -1, 1, -2, ... -> 0, 1, 2, 3, ...
+		WriteVarint(Buffer, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	bool ReadVarint(const TArray<uint8>& Buffer, int32& Offset, uint64& OutValue)
+	{
+		OutValue = 0;
+		for (int32 Shift = 0; Shift < 64; Shift += 7)
+		{
+			if (Offset >= Buffer.Num())
+			{
+				return false;
+			}
+
+			const uint8 Byte = Buffer[Offset++];
+			OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool ReadSignedVarint(const TArray<uint8>& Buffer, int32& Offset, int64& OutValue)
+	{
+		uint64 Value = 0;
+		if (ReadVarint(Buffer, Offset, Value) == false)
+		{
+			return false;
+		}
+
+		OutValue = static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+		return true;
+	}
+
+	int32 QuantizePosition(double Value)
+	{
+		return static_cast<int32>(FMath::Clamp<double>(FMath::RoundToDouble(Value * PositionQuantizeScale), MIN_int32, MAX_int32));
+	}
+
+	FVector DequantizePosition(const FIntVector& Value)
+	{
+		return FVector(Value) / PositionQuantizeScale;
+	}
+
+}
+
+FSkullyGhostWriter::~FSkullyGhostWriter()
+{
+	Close();
+}
+
+bool FSkullyGhostWriter::Open(const FString& FilePath, float InSampleRate, float InBodyRadius, float InPositionTolerance)
+{
+	Close();
+
+	FileWriter.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (FileWriter.IsValid() == false)
+	{
+		return false;
+	}
+
+	SampleRate = FMath::Max(InSampleRate, 1.0f);
+	PositionToleranceSquared = FMath::Square(FMath::Max(InPositionTolerance, 0.0f));
+
+	bHasAnchor = false;
+	PendingSamples.Reset();
+	ChunkBuffer.Reset();
+	ChunkKeys = 0;
+	NumSamples = 0;
+	NumKeys = 0;
+
+	uint32 Magic = GhostFileMagic;
+	uint32 Version = GhostFileVersion;
+	float BodyRadius = InBodyRadius;
+	*FileWriter << Magic << Version << SampleRate << BodyRadius;
+	NumBytes = FileWriter->Tell();
+
+	return FileWriter->IsError() == false;
+}
+
+bool FSkullyGhostWriter::Close()
+{
+	if (FileWriter.IsValid() == false)
+	{
+		return false;
+	}
+
+	// 마지막 샘플은 항상 키로 남김(재생이 녹화 끝까지 이어지도록)
+	if (PendingSamples.Num() > 0)
+	{
+		EmitKey(PendingSamples.Last());
+		PendingSamples.Reset();
+	}
+	FlushChunk();
+
+	// 끝 표시
+	uint16 EndKeys = 0;
+	uint16 EndBytes = 0;
+	*FileWriter << EndKeys << EndBytes;
+	NumBytes += sizeof(EndKeys) + sizeof(EndBytes);
+
+	const bool bSucceeded = FileWriter->Close();
+	FileWriter.Reset();
+	bHasAnchor = false;
+
+	return bSucceeded;
+}
+
+void FSkullyGhostWriter::AddSample(int32 Tick, const FVector& Location, ESkullyMovementMode Mode)
+{
+	if (FileWriter.IsValid() == false)
+	{
+		return;
+	}
+
+	// 녹화 시점에 양자화해서, 허용 오차 검사와 재생이 같은 값을 보게 함
+	FQuantizedSample Sample;
+	Sample.Tick = Tick;
+	Sample.Location = FIntVector(QuantizePosition(Location.X), QuantizePosition(Location.Y), QuantizePosition(Location.Z));
+	Sample.Mode = static_cast<uint8>(Mode);
+
+	if (bHasAnchor == false)
+	{
+		EmitKey(Sample);
+		Anchor = Sample;
+		bHasAnchor = true;
+		++NumSamples;
+		return;
+	}
+
+	const int32 LastTick = PendingSamples.Num() > 0 ? PendingSamples.Last().Tick : Anchor.Tick;
+	if (Sample.Tick <= LastTick)
+	{
+		return;
+	}
+	++NumSamples;
+
+	// 이동 모드가 바뀌면 바뀌기 직전과 직후를 모두 키로 남김(착지/낙하 시점 보존)
+	if (Sample.Mode != Anchor.Mode)
+	{
+		if (PendingSamples.Num() > 0)
+		{
+			EmitKey(PendingSamples.Last());
+			PendingSamples.Reset();
+		}
+		EmitKey(Sample);
+		Anchor = Sample;
+		return;
+	}
+
+	// 직선으로 이어지지 않으면 직전 샘플을 키로 확정하고 거기서 새 구간 시작
+	if (PendingSamples.Num() >= MaxPendingSamples || FitsSegment(Sample) == false)
+	{
+		if (PendingSamples.Num() > 0)
+		{
+			Anchor = PendingSamples.Last();
+			EmitKey(Anchor);
+			PendingSamples.Reset();
+		}
+	}
+
+	PendingSamples.Add(Sample);
+}
+
+bool FSkullyGhostWriter::FitsSegment(const FQuantizedSample& Candidate) const
+{
+	const FVector AnchorLocation = DequantizePosition(Anchor.Location);
+	const FVector CandidateLocation = DequantizePosition(Candidate.Location);
+	const float TickSpan = static_cast<float>(Candidate.Tick - Anchor.Tick);
+
+	for (const FQuantizedSample& Sample : PendingSamples)
+	{
+		const float Alpha = (Sample.Tick - Anchor.Tick) / TickSpan;
+
+		const FVector Interpolated = FMath::Lerp(AnchorLocation, CandidateLocation, Alpha);
+		if (FVector::DistSquared(Interpolated, DequantizePosition(Sample.Location)) > PositionToleranceSquared)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FSkullyGhostWriter::EmitKey(const FQuantizedSample& Key)
+{
+	// 청크 첫 키는 0 기준(청크마다 독립 디코드)
+	if (ChunkKeys == 0)
+	{
+		ChunkPrevKey = FQuantizedSample();
+	}
+
+	WriteVarint(ChunkBuffer, static_cast<uint64>(Key.Tick - ChunkPrevKey.Tick));
+	WriteSignedVarint(ChunkBuffer, static_cast<int64>(Key.Location.X) - ChunkPrevKey.Location.X);
+	WriteSignedVarint(ChunkBuffer, static_cast<int64>(Key.Location.Y) - ChunkPrevKey.Location.Y);
+	WriteSignedVarint(ChunkBuffer, static_cast<int64>(Key.Location.Z) - ChunkPrevKey.Location.Z);
+	ChunkBuffer.Add(Key.Mode);
+
+	ChunkPrevKey = Key;
+	++ChunkKeys;
+	++NumKeys;
+
+	if (ChunkKeys >= KeysPerChunk)
+	{
+		FlushChunk();
+	}
+}
+
+void FSkullyGhostWriter::FlushChunk()
+{
+	if (ChunkKeys == 0 || FileWriter.IsValid() == false)
+	{
+		return;
+	}
+
+	uint16 Keys = static_cast<uint16>(ChunkKeys);
+	uint16 Bytes = static_cast<uint16>(ChunkBuffer.Num());
+	*FileWriter << Keys << Bytes;
+	FileWriter->Serialize(ChunkBuffer.GetData(), ChunkBuffer.Num());
+	NumBytes += sizeof(Keys) + sizeof(Bytes) + ChunkBuffer.Num();
+
+	ChunkBuffer.Reset();
+	ChunkKeys = 0;
+}
+
+FString FSkullyGhostWriter::ResolveFilePath(const FString& NameOrPath)
+{
+	if (FPaths::IsRelative(NameOrPath) == false || NameOrPath.Contains(TEXT("/")) == true)
+	{
+		return NameOrPath;
+	}
+
+	return FPaths::ProjectSavedDir() / TEXT("SkullyGhost") / (NameOrPath + TEXT(".skghost"));
+}
+
+bool FSkullyGhostReader::Open(const FString& FilePath)
+{
+	Close();
+
+	FileReader.Reset(IFileManager::Get().CreateFileReader(*FilePath));
+	if (FileReader.IsValid() == false)
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*FileReader << Magic << Version << SampleRate << BodyRadius;
+
+	if (FileReader->IsError() == true || Magic != GhostFileMagic || Version != GhostFileVersion || SampleRate <= 0.0f)
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FSkullyGhostReader::Close()
+{
+	FileReader.Reset();
+	ChunkBuffer.Empty();
+	ChunkOffset = 0;
+	ChunkKeysLeft = 0;
+	bEnded = false;
+}
+
+bool FSkullyGhostReader::ReadChunk()
+{
+	if (FileReader.IsValid() == false || bEnded == true)
+	{
+		return false;
+	}
+
+	uint16 Keys = 0;
+	uint16 Bytes = 0;
+	*FileReader << Keys << Bytes;
+
+	// 끝 표시(키 수 0)이거나 잘린 파일
+	if (FileReader->IsError() == true || Keys == 0 || FileReader->TotalSize() - FileReader->Tell() < Bytes)
+	{
+		bEnded = true;
+		return false;
+	}
+
+	ChunkBuffer.SetNumUninitialized(Bytes, EAllowShrinking::No);
+	FileReader->Serialize(ChunkBuffer.GetData(), Bytes);
+	ChunkOffset = 0;
+	ChunkKeysLeft = Keys;
+
+	PrevTick = 0;
+	PrevLocation = FIntVector::ZeroValue;
+
+	return FileReader->IsError() == false;
+}
+
+bool FSkullyGhostReader::ReadKey(FSkullyGhostKey& OutKey)
+{
+	if (ChunkKeysLeft == 0 && ReadChunk() == false)
+	{
+		return false;
+	}
+
+	uint64 TickDelta = 0;
+	int64 LocationDelta[3];
+	bool bValid = ReadVarint(ChunkBuffer, ChunkOffset, TickDelta);
+	for (int32 Axis = 0; Axis < 3 && bValid == true; ++Axis)
+	{
+		bValid = ReadSignedVarint(ChunkBuffer, ChunkOffset, LocationDelta[Axis]);
+	}
+	if (bValid == false || ChunkOffset >= ChunkBuffer.Num())
+	{
+		// 손상된 청크: 이후는 읽지 않음
+		bEnded = true;
+		ChunkKeysLeft = 0;
+		return false;
+	}
+	const uint8 Mode = ChunkBuffer[ChunkOffset++];
+	--ChunkKeysLeft;
+
+	PrevTick += static_cast<int32>(TickDelta);
+	PrevLocation = FIntVector(
+		static_cast<int32>(PrevLocation.X + LocationDelta[0]),
+		static_cast<int32>(PrevLocation.Y + LocationDelta[1]),
+		static_cast<int32>(PrevLocation.Z + LocationDelta[2]));
+
+	OutKey.Tick = PrevTick;
+	OutKey.Location = DequantizePosition(PrevLocation);
+	OutKey.Mode = Mode;
+
+	return true;
+}
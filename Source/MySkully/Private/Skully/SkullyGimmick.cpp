@@ -0,0 +1,99 @@
+/*
+ * 파일명: SkullyGimmick.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 맵 기믹의 기반 액터(트리거 볼륨을 기믹 서브시스템 격자에 등록하고 진입/이탈 이벤트만 받음, 되감기 상태 기록)
+ */
+
+#include "Skully/SkullyGimmick.h"
+
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "Skully/SkullyGimmickSubsystem.h"
+#include "Skully/SkullyRewindSubsystem.h"
+
+ASkullyGimmick::ASkullyGimmick()
+{
+	// 진입/이탈은 서브시스템이 알려주므로 Tick 없음
+	PrimaryActorTick.bCanEverTick = false;
+
+	TriggerVolume = CreateDefaultSubobject<UBoxComponent>(TEXT("TriggerVolume"));
+	RootComponent = TriggerVolume;
+	TriggerVolume->SetBoxExtent(FVector(200.0f, 200.0f, 200.0f));
+	TriggerVolume->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	TriggerVolume->SetGenerateOverlapEvents(false);
+}
+
+void ASkullyGimmick::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (USkullyGimmickSubsystem* Gimmicks = GetWorld()->GetSubsystem<USkullyGimmickSubsystem>())
+	{
+		Gimmicks->RegisterGimmick(this);
+	}
+	
+	if (USkullyRewindSubsystem* Rewind = GetWorld()->GetSubsystem<USkullyRewindSubsystem>())
+	{
+		Rewind->RegisterGimmick(this);
+	}
+}
+
+void ASkullyGimmick::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USkullyGimmickSubsystem* Gimmicks = GetWorld()->GetSubsystem<USkullyGimmickSubsystem>())
+	{
+		Gimmicks->UnregisterGimmick(this);
+	}
+	
+	if (USkullyRewindSubsystem* Rewind = GetWorld()->GetSubsystem<USkullyRewindSubsystem>())
+	{
+		Rewind->UnregisterGimmick(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FBox ASkullyGimmick::GetTriggerBounds() const
+{
+	return TriggerVolume->Bounds.GetBox();
+}
+
+bool ASkullyGimmick::IsInsideTrigger(const FVector& Location, float Radius) const
+{
+	// 박스 로컬 공간에서 구 중심과 가장 가까운 점까지의 거리로 판정
+	const FTransform& BoxTransform = TriggerVolume->GetComponentTransform();
+	const FVector LocalLocation = BoxTransform.InverseTransformPositionNoScale(Location);
+	const FVector Extent = TriggerVolume->GetScaledBoxExtent();
+	const FVector Closest = LocalLocation.BoundToBox(-Extent, Extent);
+
+	return FVector::DistSquared(LocalLocation, Closest) <= FMath::Square(Radius);
+}
+
+void ASkullyGimmick::RefreshTrigger()
+{
+	if (USkullyGimmickSubsystem* Gimmicks = GetWorld()->GetSubsystem<USkullyGimmickSubsystem>())
+	{
+		Gimmicks->UpdateGimmick(this);
+	}
+}
+
+void ASkullyGimmick::SerializeRewindState(FArchive& Ar)
+{
+	FTransform Transform = GetActorTransform();
+	Ar << Transform;
+	
+	if (Ar.IsLoading() == true && Transform.Equals(GetActorTransform()) == false)
+	{
+		SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+		RefreshTrigger();
+	}
+}
+
+void ASkullyGimmick::OnSkullyEnter_Implementation(USkullyMovementComponent* Body)
+{
+}
+
+void ASkullyGimmick::OnSkullyExit_Implementation(USkullyMovementComponent* Body)
+{
+}
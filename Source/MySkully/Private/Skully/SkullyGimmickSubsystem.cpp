@@ -0,0 +1,279 @@
+/*
+ * 파일명: SkullyGimmickSubsystem.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 기믹 트리거 볼륨의 균일 격자 공간 해시와 Skully 진입/이탈 판정
+ */
+
+#include "Skully/SkullyGimmickSubsystem.h"
+
+#include "Components/SphereComponent.h"
+#include "Skully/SkullyGimmick.h"
+#include "Skully/SkullyMovementComponent.h"
+#include "Skully/SkullyMovementStats.h"
+
+namespace
+{
+	// 몸체 위치/반지름(구가 아니면 바운드 반지름)
+	bool GetBodySphere(const USkullyMovementComponent* Body, FVector& OutLocation, float& OutRadius)
+	{
+		const USceneComponent* Updated = Body != nullptr ? Body->UpdatedComponent : nullptr;
+		if (Updated == nullptr)
+		{
+			return false;
+		}
+		
+		OutLocation = Updated->GetComponentLocation();
+		const USphereComponent* Sphere = Cast<USphereComponent>(Updated);
+		OutRadius = Sphere != nullptr ? Sphere->GetScaledSphereRadius() : Updated->Bounds.SphereRadius;
+		return true;
+	}
+}
+
+FIntPoint USkullyGimmickSubsystem::GetCellCoord(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void USkullyGimmickSubsystem::Deinitialize()
+{
+	Cells.Empty();
+	Gimmicks.Empty();
+	Bodies.Empty();
+	
+	Super::Deinitialize();
+}
+
+TStatId USkullyGimmickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkullyGimmickSubsystem, STATGROUP_Tickables);
+}
+
+void USkullyGimmickSubsystem::RegisterGimmick(ASkullyGimmick* Gimmick)
+{
+	if (Gimmick == nullptr || Gimmicks.Contains(Gimmick) == true)
+	{
+		return;
+	}
+	
+	FGimmickEntry& Entry = Gimmicks.Add(Gimmick);
+	Entry.Gimmick = Gimmick;
+	
+	const FBox Bounds = Gimmick->GetTriggerBounds().ExpandBy(BodyMargin);
+	Entry.MinCell = GetCellCoord(Bounds.Min);
+	Entry.MaxCell = GetCellCoord(Bounds.Max);
+	AddToCells(Gimmick, Entry.MinCell, Entry.MaxCell);
+	
+	RefreshActiveBodies();
+}
+
+void USkullyGimmickSubsystem::UnregisterGimmick(ASkullyGimmick* Gimmick)
+{
+	FGimmickEntry Entry;
+	if (Gimmicks.RemoveAndCopyValue(Gimmick, Entry) == false)
+	{
+		return;
+	}
+	
+	RemoveFromCells(Gimmick, Entry.MinCell, Entry.MaxCell);
+	
+	// 사라지는 기믹에는 이탈 이벤트를 보내지 않음
+	for (FBodyEntry& Body : Bodies)
+	{
+		Body.Inside.Remove(Gimmick);
+	}
+	
+	RefreshActiveBodies();
+}
+
+void USkullyGimmickSubsystem::UpdateGimmick(ASkullyGimmick* Gimmick)
+{
+	FGimmickEntry* Entry = Gimmicks.Find(Gimmick);
+	if (Entry == nullptr)
+	{
+		RegisterGimmick(Gimmick);
+		return;
+	}
+	
+	const FBox Bounds = Gimmick->GetTriggerBounds().ExpandBy(BodyMargin);
+	const FIntPoint MinCell = GetCellCoord(Bounds.Min);
+	const FIntPoint MaxCell = GetCellCoord(Bounds.Max);
+	if (MinCell == Entry->MinCell && MaxCell == Entry->MaxCell)
+	{
+		return;
+	}
+	
+	RemoveFromCells(Gimmick, Entry->MinCell, Entry->MaxCell);
+	Entry->MinCell = MinCell;
+	Entry->MaxCell = MaxCell;
+	AddToCells(Gimmick, MinCell, MaxCell);
+	
+	RefreshActiveBodies();
+}
+
+void USkullyGimmickSubsystem::AddToCells(ASkullyGimmick* Gimmick, const FIntPoint& MinCell, const FIntPoint& MaxCell)
+{
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).AddUnique(Gimmick);
+		}
+	}
+}
+
+void USkullyGimmickSubsystem::RemoveFromCells(ASkullyGimmick* Gimmick, const FIntPoint& MinCell, const FIntPoint& MaxCell)
+{
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			const FIntPoint Cell(X, Y);
+			if (TArray<TWeakObjectPtr<ASkullyGimmick>>* CellGimmicks = Cells.Find(Cell))
+			{
+				CellGimmicks->RemoveSwap(Gimmick);
+				if (CellGimmicks->Num() == 0)
+				{
+					Cells.Remove(Cell);
+				}
+			}
+		}
+	}
+}
+
+void USkullyGimmickSubsystem::NotifyBodyCellChanged(USkullyMovementComponent* Body, const FIntPoint& NewCell)
+{
+	if (Body == nullptr)
+	{
+		return;
+	}
+	
+	INC_DWORD_STAT(STAT_SkullyGimmickCellCrossings);
+	
+	FBodyEntry* Entry = Bodies.FindByPredicate([Body](const FBodyEntry& Other) { return Other.Body.Get() == Body; });
+	if (Entry == nullptr)
+	{
+		Entry = &Bodies.AddDefaulted_GetRef();
+		Entry->Body = Body;
+	}
+	
+	Entry->Cell = NewCell;
+	Entry->bActive = NeedsEvaluation(*Entry);
+}
+
+void USkullyGimmickSubsystem::RemoveBody(USkullyMovementComponent* Body)
+{
+	const int32 Index = Bodies.IndexOfByPredicate([Body](const FBodyEntry& Other) { return Other.Body.Get() == Body; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+	
+	const TArray<TWeakObjectPtr<ASkullyGimmick>> Inside = MoveTemp(Bodies[Index].Inside);
+	Bodies.RemoveAtSwap(Index);
+	
+	for (const TWeakObjectPtr<ASkullyGimmick>& Gimmick : Inside)
+	{
+		if (Gimmick.IsValid() == true)
+		{
+			Gimmick->OnSkullyExit(Body);
+		}
+	}
+}
+
+bool USkullyGimmickSubsystem::NeedsEvaluation(const FBodyEntry& Entry) const
+{
+	return Entry.Inside.Num() > 0 || Cells.Contains(Entry.Cell) == true;
+}
+
+void USkullyGimmickSubsystem::RefreshActiveBodies()
+{
+	for (FBodyEntry& Entry : Bodies)
+	{
+		Entry.bActive = NeedsEvaluation(Entry);
+	}
+}
+
+void USkullyGimmickSubsystem::Tick(float DeltaTime)
+{
+	TArray<FGimmickEvent> Enters;
+	TArray<FGimmickEvent> Exits;
+	
+	for (int32 Index = Bodies.Num() - 1; Index >= 0; --Index)
+	{
+		FBodyEntry& Entry = Bodies[Index];
+		if (Entry.Body.IsValid() == false)
+		{
+			Bodies.RemoveAtSwap(Index);
+			continue;
+		}
+		
+		if (Entry.bActive == true)
+		{
+			EvaluateBody(Entry, Enters, Exits);
+		}
+	}
+	
+	// 이벤트에서 기믹/몸체가 등록/해제될 수 있으므로 순회가 끝난 뒤 호출
+	for (const FGimmickEvent& Event : Exits)
+	{
+		if (Event.Key.IsValid() == true && Event.Value.IsValid() == true)
+		{
+			Event.Key->OnSkullyExit(Event.Value.Get());
+		}
+	}
+	for (const FGimmickEvent& Event : Enters)
+	{
+		if (Event.Key.IsValid() == true && Event.Value.IsValid() == true)
+		{
+			Event.Key->OnSkullyEnter(Event.Value.Get());
+		}
+	}
+}
+
+void USkullyGimmickSubsystem::EvaluateBody(FBodyEntry& Entry, TArray<FGimmickEvent>& OutEnters, TArray<FGimmickEvent>& OutExits)
+{
+	FVector Location;
+	float Radius;
+	if (GetBodySphere(Entry.Body.Get(), Location, Radius) == false)
+	{
+		return;
+	}
+	
+	const TArray<TWeakObjectPtr<ASkullyGimmick>>* Candidates = Cells.Find(Entry.Cell);
+	
+	// 이탈: 안에 있던 기믹 중 더 이상 겹치지 않는 것(다른 칸으로 벗어났으면 후보에 없어도 검사)
+	for (int32 Index = Entry.Inside.Num() - 1; Index >= 0; --Index)
+	{
+		const TWeakObjectPtr<ASkullyGimmick> Gimmick = Entry.Inside[Index];
+		INC_DWORD_STAT(STAT_SkullyGimmickEvaluations);
+		
+		if (Gimmick.IsValid() == false || Gimmick->IsInsideTrigger(Location, Radius) == false)
+		{
+			Entry.Inside.RemoveAtSwap(Index);
+			OutExits.Emplace(Gimmick, Entry.Body);
+		}
+	}
+	
+	// 진입: 현재 칸의 기믹 중 새로 겹친 것
+	if (Candidates != nullptr)
+	{
+		for (const TWeakObjectPtr<ASkullyGimmick>& Gimmick : *Candidates)
+		{
+			if (Gimmick.IsValid() == false || Entry.Inside.Contains(Gimmick) == true)
+			{
+				continue;
+			}
+			
+			INC_DWORD_STAT(STAT_SkullyGimmickEvaluations);
+			
+			if (Gimmick->IsInsideTrigger(Location, Radius) == true)
+			{
+				Entry.Inside.Add(Gimmick);
+				OutEnters.Emplace(Gimmick, Entry.Body);
+			}
+		}
+	}
+	
+	Entry.bActive = NeedsEvaluation(Entry);
+}
@@ -0,0 +1,229 @@
+/*
+ * 파일명: SkullyInputRecording.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 입력 녹화/재생(틱 단위 양자화 입력 스트림과 재생 드라이버)
+ */
+
+#include "Skully/SkullyInputRecording.h"
+
+#include "MySkully.h"
+#include "Skully/Skully.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	// 'SKIR'
+	constexpr uint32 InputStreamMagic = 0x52494B53;
+	// 2: 월드 기준 이동 입력/DeltaTime 원본 값, 시작 이동 상태와 컨트롤 회전 헤더
+	constexpr uint32 InputStreamVersion = 2;
+
+	// 프레임당 바이트(WorldMove 8 + 컨트롤 회전 4 + DeltaTime 4)
+	constexpr int64 FrameBytes = 16;
+}
+
+FVector SkullyInput::ToWorldMoveInput(const FVector2D& MoveInput, const FRotator& ControlRotation)
+{
+	const FRotator YawRotation(0.0, ControlRotation.Yaw, 0.0);
+
+	const FVector ForwardDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X);
+	const FVector RightDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
+
+	return ForwardDirection * MoveInput.Y + RightDirection * MoveInput.X;
+}
+
+void FSkullyInputStream::AddFrame(const FSkullyInputFrame& Frame)
+{
+	// 파일에서 읽은 스트림과 같은 값을 재생하도록 컨트롤 회전은 저장 형식으로 양자화
+	FSkullyInputFrame& Added = Frames.Add_GetRef(Frame);
+	Added.ControlRotation = FRotator(
+		FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Frame.ControlRotation.Pitch)),
+		FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Frame.ControlRotation.Yaw)),
+		0.0f);
+}
+
+void FSkullyInputStream::SetInitialState(const FSkullyMovementSnapshot& InState, const FRotator& InControlRotation)
+{
+	InitialState = InState;
+	InitialControlRotation = InControlRotation;
+}
+
+float FSkullyInputStream::GetDuration() const
+{
+	float Duration = 0.0f;
+	for (const FSkullyInputFrame& Frame : Frames)
+	{
+		Duration += Frame.DeltaTime;
+	}
+
+	return Duration;
+}
+
+bool FSkullyInputStream::SaveToFile(const FString& FilePath) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = InputStreamMagic;
+	uint32 Version = InputStreamVersion;
+	int32 NumFrames = Frames.Num();
+	Writer << Magic << Version << NumFrames;
+
+	FSkullyMovementSnapshot State = InitialState;
+	FRotator ControlRotation = InitialControlRotation;
+	SerializeInitialState(Writer, State, ControlRotation);
+
+	for (FSkullyInputFrame Frame : Frames)
+	{
+		SerializeFrame(Writer, Frame);
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FSkullyInputStream::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (FFileHelper::LoadFileToArray(Bytes, *FilePath) == false)
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 NumFrames = 0;
+	Reader << Magic << Version << NumFrames;
+
+	if (Magic != InputStreamMagic || Version != InputStreamVersion || NumFrames < 0)
+	{
+		return false;
+	}
+
+	SerializeInitialState(Reader, InitialState, InitialControlRotation);
+
+	// 프레임 데이터보다 짧으면 잘린 파일
+	if (Reader.IsError() == true || Reader.TotalSize() - Reader.Tell() < static_cast<int64>(NumFrames) * FrameBytes)
+	{
+		return false;
+	}
+
+	Frames.Reset(NumFrames);
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		SerializeFrame(Reader, Frames.AddDefaulted_GetRef());
+	}
+
+	return Reader.IsError() == false;
+}
+
+FString FSkullyInputStream::ResolveFilePath(const FString& NameOrPath)
+{
+	if (FPaths::IsRelative(NameOrPath) == false || NameOrPath.Contains(TEXT("/")) == true)
+	{
+		return NameOrPath;
+	}
+
+	return FPaths::ProjectSavedDir() / TEXT("SkullyInput") / (NameOrPath + TEXT(".skinput"));
+}
+
+void FSkullyInputStream::SerializeFrame(FArchive& Ar, FSkullyInputFrame& Frame)
+{
+	float MoveX = static_cast<float>(Frame.WorldMove.X);
+	float MoveY = static_cast<float>(Frame.WorldMove.Y);
+	uint16 ControlYaw = FRotator::CompressAxisToShort(Frame.ControlRotation.Yaw);
+	uint16 ControlPitch = FRotator::CompressAxisToShort(Frame.ControlRotation.Pitch);
+	Ar << MoveX << MoveY << ControlYaw << ControlPitch << Frame.DeltaTime;
+
+	if (Ar.IsLoading() == true)
+	{
+		Frame.WorldMove = FVector2D(MoveX, MoveY);
+		Frame.ControlRotation = FRotator(FRotator::DecompressAxisFromShort(ControlPitch), FRotator::DecompressAxisFromShort(ControlYaw), 0.0f);
+	}
+}
+
+// 시작 상태는 전체 정밀도로 저장(양자화하면 첫 틱부터 녹화와 달라짐)
+void FSkullyInputStream::SerializeInitialState(FArchive& Ar, FSkullyMovementSnapshot& State, FRotator& ControlRotation)
+{
+	Ar << State.Location << State.Velocity << State.CachedFloorNormal << State.LastFloorNormal;
+	Ar << State.MovementMode << State.bIsSlopeSliding << State.TimeAccumulator;
+	Ar << State.LastInputX << State.LastInputY;
+	Ar << ControlRotation;
+}
+
+void FSkullyInputReplayer::Start(const FSkullyInputStream& InStream)
+{
+	Stream = InStream;
+	FrameIndex = 0;
+	bPlaying = Stream.Num() > 0;
+}
+
+void FSkullyInputReplayer::Stop()
+{
+	bPlaying = false;
+	Stream.Reset();
+}
+
+bool FSkullyInputReplayer::Next(FVector& OutWorldInput, float& OutDeltaTime, FRotator& OutControlRotation)
+{
+	if (bPlaying == false || FrameIndex >= Stream.Num())
+	{
+		bPlaying = false;
+		return false;
+	}
+
+	const FSkullyInputFrame& Frame = Stream[FrameIndex++];
+
+	OutWorldInput = FVector(Frame.WorldMove, 0.0f);
+	OutDeltaTime = Frame.DeltaTime;
+	OutControlRotation = Frame.ControlRotation;
+
+	return true;
+}
+
+namespace
+{
+	ASkully* GetPlayerSkully(UWorld* World)
+	{
+		return World != nullptr ? Cast<ASkully>(UGameplayStatics::GetPlayerPawn(World, 0)) : nullptr;
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("Skully.Input.Record"),
+		TEXT("플레이어 Skully의 입력 녹화 시작"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (ASkully* Skully = GetPlayerSkully(World))
+			{
+				Skully->StartInputRecording();
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs StopRecordCommand(
+		TEXT("Skully.Input.StopRecord"),
+		TEXT("입력 녹화 종료 후 저장: Skully.Input.StopRecord [이름 또는 경로=LastRecording]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (ASkully* Skully = GetPlayerSkully(World))
+			{
+				Skully->StopInputRecording(Args.Num() > 0 ? Args[0] : TEXT("LastRecording"));
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("Skully.Input.Replay"),
+		TEXT("녹화된 입력 재생: Skully.Input.Replay [이름 또는 경로=LastRecording]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (ASkully* Skully = GetPlayerSkully(World))
+			{
+				Skully->StartInputReplay(Args.Num() > 0 ? Args[0] : TEXT("LastRecording"));
+			}
+		}));
+}
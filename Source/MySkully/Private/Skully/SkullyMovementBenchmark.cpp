@@ -0,0 +1,1120 @@
+/*
+ * 파일명: SkullyMovementBenchmark.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: USkullyMovementComponent 헤드리스 벤치마크/회귀 확인(Skully.Bench.Movement 콘솔 명령)
+ *
+ * 사용 예(Linux, 렌더링 없이):
+ *   UnrealEditor-Cmd MySkully.uproject /Game/Maps/Test -game -nullrhi -unattended -ExecCmds="Skully.Bench.Movement 600 0.016667 quit"
+ *   녹화된 입력 사용: -ExecCmds="Skully.Bench.Movement 0 0.016667 input=MyRun quit" (틱 수는 녹화 길이)
+ * 경사/엣지/코너 테스트 지형을 절차적으로 생성하고, 고정 DeltaTime으로 스크립트(또는 녹화된) 입력을 재생하면서
+ * 틱당 시간(ns), 틱당 씬 쿼리 수, 최종 위치 체크섬을 로그와 Saved/SkullyBench/MovementBench.csv에 기록한다.
+ * 체크섬이 바뀌면 Move/CheckGround 동작이 바뀐 것이다.
+ * 테스트 지형은 실제 레벨처럼 Static 모빌리티로 생성하므로 바닥 쿼리 캐시/Walkability 필드가 레벨과 같은 경로로 동작한다.
+ * 매 틱 이동 상태를 전체 정밀도로 보낼 때와 양자화 키프레임/델타(SkullyMovementStateCodec)로 보낼 때의 상태당 바이트도 함께 기록한다.
+ *
+ * 배치 시뮬레이터(USkullyBodyBatchSubsystem): Skully.Bench.Batch [바디 수 목록=100,1000,5000] [스텝 수=300] [quit]
+ *   바디 수마다 같은 지형 위에서 StepBodies를 반복하고 초당 스텝 수/초당 바디-스텝 수를 Saved/SkullyBench/BatchBench.csv에 기록한다.
+ *
+ * 움직이는 바닥(ASkullyMovingPlatform): Skully.Bench.Platforms [발판 수=64] [틱 수=600] [quit]
+ *   왕복/승강/회전하는 발판마다 Skully를 하나씩 올려 두고, 바닥 추적을 끈 경우와 켠 경우의 틱당 시간/쿼리 수와
+ *   끝까지 발판 위에 남은 수를 Saved/SkullyBench/PlatformBench.csv에 기록한다.
+ *
+ * 이동 모델 커널(SkullyMovementKernel): Skully.Bench.Kernel [바디 수=4096] [스텝 수=200] [quit]
+ *   무작위 상태(경사/평지, 입력 유무, 슬라이딩 유무)에서 스칼라 경로와 SIMD 경로를 같은 입력으로 실행해 결과 차이를 허용 오차와 비교(PASS/FAIL)하고,
+ *   두 경로의 바디당 시간(ns)을 Saved/SkullyBench/KernelBench.csv에 기록한다.
+ */
+
+#include "MySkully.h"
+#include "Skully/Skully.h"
+#include "Skully/SkullyBodyBatchSubsystem.h"
+#include "Skully/SkullyInputRecording.h"
+#include "Skully/SkullyMovementComponent.h"
+#include "Skully/SkullyMovementKernel.h"
+#include "Skully/SkullyMovementStateCodec.h"
+#include "Skully/SkullyMovingPlatform.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace SkullyMovementBenchmark
+{
+	// 다른 레벨 지오메트리와 겹치지 않도록 테스트 지형을 띄워 둘 위치
+	const FVector BenchOrigin(0.0f, 0.0f, 50000.0f);
+
+	// 스크립트 입력 패턴
+	enum class EInputPattern : uint8
+	{
+		None,
+		Forward,
+		Circle,
+		Zigzag
+	};
+
+	// 테스트 지형 생성 시 사용할 엔진 기본 큐브(100cm, 중심 피벗)
+	struct FGeometryBuilder
+	{
+		UWorld* World = nullptr;
+		UStaticMesh* Cube = nullptr;
+		TArray<TWeakObjectPtr<AActor>>* SpawnedActors = nullptr;
+
+		void AddBox(const FVector& Center, const FRotator& Rotation, const FVector& SizeCm) const
+		{
+			const FTransform Transform(Rotation, BenchOrigin + Center, SizeCm / 100.0f);
+			AStaticMeshActor* Actor = World->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform);
+			if (Actor == nullptr)
+			{
+				return;
+			}
+
+			// Static 모빌리티 그대로 두고 컴포넌트 등록(FinishSpawning) 전에 메시 설정
+			// 등록 뒤에는 Static 컴포넌트의 메시를 바꿀 수 없고, Movable로 바꾸면 움직이는 바닥으로 취급되어 실제 레벨과 다른 경로를 잼
+			Actor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+			Actor->FinishSpawning(Transform);
+			SpawnedActors->Add(Actor);
+		}
+	};
+
+	// 벤치마크 시나리오: 지형 + 시작 위치 + 입력 패턴
+	struct FScenario
+	{
+		const TCHAR* Name;
+		void (*BuildGeometry)(const FGeometryBuilder& Builder);
+		FVector StartLocation;
+		EInputPattern Input;
+	};
+
+	// 평지
+	void BuildFlat(const FGeometryBuilder& Builder)
+	{
+		Builder.AddBox(FVector(0.0f, 0.0f, -50.0f), FRotator::ZeroRotator, FVector(6000.0f, 6000.0f, 100.0f));
+	}
+
+	// 20도 경사
+	void BuildSlope(const FGeometryBuilder& Builder)
+	{
+		Builder.AddBox(FVector(0.0f, 0.0f, -50.0f), FRotator(20.0f, 0.0f, 0.0f), FVector(6000.0f, 6000.0f, 100.0f));
+	}
+
+	// 15도 경사 두 면이 만나는 능선(엣지): 노멀이 튀는 경계에서 downhill 샘플 경로를 확인
+	void BuildRidge(const FGeometryBuilder& Builder)
+	{
+		const float Length = 3000.0f;
+		const float Angle = FMath::DegreesToRadians(15.0f);
+		const float HalfX = Length * 0.5f * FMath::Cos(Angle);
+		const float HalfZ = Length * 0.5f * FMath::Sin(Angle);
+
+		Builder.AddBox(FVector(-HalfX, 0.0f, -HalfZ - 50.0f), FRotator(15.0f, 0.0f, 0.0f), FVector(Length, 4000.0f, 100.0f));
+		Builder.AddBox(FVector(HalfX, 0.0f, -HalfZ - 50.0f), FRotator(-15.0f, 0.0f, 0.0f), FVector(Length, 4000.0f, 100.0f));
+	}
+
+	// 평지 + 두 벽이 만나는 코너: 코너로 밀어붙이며 SlideAlongSurface/2-pass 재투영 경로를 확인
+	void BuildCorner(const FGeometryBuilder& Builder)
+	{
+		BuildFlat(Builder);
+		Builder.AddBox(FVector(0.0f, 1500.0f, 250.0f), FRotator::ZeroRotator, FVector(3000.0f, 100.0f, 500.0f));
+		Builder.AddBox(FVector(1500.0f, 0.0f, 250.0f), FRotator::ZeroRotator, FVector(100.0f, 3000.0f, 500.0f));
+	}
+
+	// 높은 단 끝에서 아래 바닥으로 떨어지는 턱: Grounded -> Falling -> 착지 경로를 확인
+	void BuildLedge(const FGeometryBuilder& Builder)
+	{
+		Builder.AddBox(FVector(0.0f, 0.0f, -50.0f), FRotator::ZeroRotator, FVector(2000.0f, 3000.0f, 100.0f));
+		Builder.AddBox(FVector(3000.0f, 0.0f, -350.0f), FRotator::ZeroRotator, FVector(4000.0f, 3000.0f, 100.0f));
+	}
+
+	const FScenario Scenarios[] =
+	{
+		{ TEXT("FlatIdle"), &BuildFlat, FVector(0.0f, 0.0f, 100.0f), EInputPattern::None },
+		{ TEXT("FlatCircle"), &BuildFlat, FVector(0.0f, 0.0f, 100.0f), EInputPattern::Circle },
+		{ TEXT("SlopeIdle"), &BuildSlope, FVector(0.0f, 0.0f, 150.0f), EInputPattern::None },
+		{ TEXT("SlopeZigzag"), &BuildSlope, FVector(0.0f, 0.0f, 150.0f), EInputPattern::Zigzag },
+		{ TEXT("RidgeIdle"), &BuildRidge, FVector(0.0f, 0.0f, 120.0f), EInputPattern::None },
+		{ TEXT("CornerPush"), &BuildCorner, FVector(0.0f, 0.0f, 100.0f), EInputPattern::Forward },
+		{ TEXT("LedgeDrop"), &BuildLedge, FVector(0.0f, 0.0f, 100.0f), EInputPattern::Forward },
+	};
+
+	// 틱 번호에 해당하는 월드 기준 입력
+	FVector GetScriptedInput(EInputPattern Pattern, int32 TickIndex, float DeltaTime)
+	{
+		const float Time = TickIndex * DeltaTime;
+
+		switch (Pattern)
+		{
+		case EInputPattern::Forward:
+			// +X 쪽으로 진행(코너 시나리오에서는 두 벽 사이로 밀어붙이는 대각선 방향)
+			return FVector(1.0f, 0.5f, 0.0f).GetSafeNormal();
+		case EInputPattern::Circle:
+			return FVector(FMath::Cos(Time), FMath::Sin(Time), 0.0f);
+		case EInputPattern::Zigzag:
+			return FVector(1.0f, FMath::Sin(Time * 4.0f) >= 0.0f ? 1.0f : -1.0f, 0.0f).GetSafeNormal();
+		default:
+			return FVector::ZeroVector;
+		}
+	}
+
+	// 시나리오 결과
+	struct FScenarioResult
+	{
+		FString Name;
+		int32 NumTicks = 0;
+		double AvgNsPerTick = 0.0;
+		double P95NsPerTick = 0.0;
+		double MaxNsPerTick = 0.0;
+		double QueriesPerTick = 0.0;
+		FVector FinalLocation = FVector::ZeroVector;
+		uint32 Checksum = 0;
+		// 상태 1회 전송당 평균 바이트: 전체 정밀도 필드, 양자화 키프레임, 델타(+주기적 키프레임)
+		double NaiveStateBytes = 0.0;
+		double KeyframeStateBytes = 0.0;
+		double DeltaStateBytes = 0.0;
+	};
+
+	// 델타 기준: 몇 틱 전에 보낸 상태를 클라이언트가 받았다고 가정(왕복 지연)
+	constexpr int32 BenchStateAckLatency = 4;
+
+	// 매 틱 상태를 보낸다고 가정하고 전송 방식별 평균 바이트 계산
+	void MeasureStateBandwidth(const TArray<FSkullyMovementSnapshot>& States, FScenarioResult& Result)
+	{
+		if (States.Num() == 0)
+		{
+			return;
+		}
+
+		// 양자화 없이 필드를 그대로 보낼 때(FVector 4개 + 모드/슬라이드/누적 시간/입력)
+		Result.NaiveStateBytes = sizeof(FVector) * 4 + sizeof(uint8) + sizeof(bool) + sizeof(float) + sizeof(int8) * 2;
+
+		const FSkullyMovementStateQuantization Quantization = SkullyMovementStateCodec::GetQuantization();
+		const int32 KeyframeInterval = SkullyMovementStateCodec::GetKeyframeInterval();
+
+		TArray<FSkullyMovementSnapshot> SentStates;
+		SentStates.Reserve(States.Num());
+		int64 KeyframeBits = 0;
+		int64 DeltaBits = 0;
+		int32 DeltasSinceKeyframe = 0;
+		for (int32 Index = 0; Index < States.Num(); ++Index)
+		{
+			KeyframeBits += (SkullyMovementStateCodec::GetPackedBits(States[Index], nullptr, Quantization) + 7) / 8 * 8;
+
+			const FSkullyMovementSnapshot* BaseState = Index >= BenchStateAckLatency && DeltasSinceKeyframe < KeyframeInterval ? &SentStates[Index - BenchStateAckLatency] : nullptr;
+			FSkullyPackedMovementState Packed;
+			FSkullyMovementSnapshot QuantizedState;
+			SkullyMovementStateCodec::Pack(Packed, States[Index], BaseState, 1, QuantizedState);
+			SentStates.Add(QuantizedState);
+			DeltaBits += (Packed.NumBits + 7) / 8 * 8;
+			DeltasSinceKeyframe = Packed.BaseSequence != 0 ? DeltasSinceKeyframe + 1 : 0;
+		}
+
+		Result.KeyframeStateBytes = KeyframeBits / 8.0 / States.Num();
+		Result.DeltaStateBytes = DeltaBits / 8.0 / States.Num();
+	}
+
+	// 최종 위치 체크섬(0.01cm 단위로 양자화해서 부동소수점 출력 형식 차이를 무시)
+	uint32 ComputeChecksum(const FVector& Location)
+	{
+		const int64 Quantized[3] =
+		{
+			FMath::RoundToInt64(Location.X * 100.0),
+			FMath::RoundToInt64(Location.Y * 100.0),
+			FMath::RoundToInt64(Location.Z * 100.0)
+		};
+
+		return FCrc::MemCrc32(Quantized, sizeof(Quantized));
+	}
+
+	/**
+	 * 시나리오를 순서대로 실행하는 러너
+	 * 비동기 트레이스(downhill 샘플) 결과가 다음 프레임에 나오므로 실제 프레임마다 한 틱씩 진행한다.
+	 */
+	class FRunner
+	{
+	public:
+		FRunner(UWorld* InWorld, int32 InTicksPerScenario, float InDeltaTime, bool bInQuitWhenDone, const FSkullyInputStream* InRecordedInput)
+			: World(InWorld), TicksPerScenario(InTicksPerScenario), DeltaTime(InDeltaTime), bQuitWhenDone(bInQuitWhenDone)
+		{
+			// 녹화된 입력이 있으면 모든 시나리오에서 스크립트 입력 대신 사용(월드 기준 이동 입력만 사용, 시작 상태는 시나리오 위치이고 DeltaTime은 고정값)
+			if (InRecordedInput != nullptr && InRecordedInput->Num() > 0)
+			{
+				RecordedInput = *InRecordedInput;
+				bUseRecordedInput = true;
+				TicksPerScenario = RecordedInput.Num();
+			}
+			
+			Cube.Reset(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		}
+
+		~FRunner()
+		{
+			CleanupScenario();
+		}
+
+		// 한 프레임 진행, 모든 시나리오가 끝나면 false
+		bool Tick()
+		{
+			if (World.IsValid() == false || Cube.IsValid() == false)
+			{
+				UE_LOG(LogSkullyMovement, Error, TEXT("[Bench] World 또는 테스트 메시가 없어 벤치마크를 중단합니다."));
+				return false;
+			}
+
+			if (Movement.IsValid() == false)
+			{
+				if (ScenarioIndex >= UE_ARRAY_COUNT(Scenarios))
+				{
+					Finish();
+					return false;
+				}
+
+				BeginScenario(Scenarios[ScenarioIndex]);
+				return true;
+			}
+
+			const FScenario& Scenario = Scenarios[ScenarioIndex];
+			FVector Input = FVector::ZeroVector;
+			if (bUseRecordedInput == true)
+			{
+				float RecordedDeltaTime;
+				FRotator ControlRotation;
+				InputReplayer.Next(Input, RecordedDeltaTime, ControlRotation);
+			}
+			else
+			{
+				Input = GetScriptedInput(Scenario.Input, TickIndex, DeltaTime);
+			}
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Movement->TickWithInput(DeltaTime, Input);
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+
+			TickNs.Add(FPlatformTime::ToSeconds64(EndCycles - StartCycles) * 1.0e9);
+			States.Add(Movement->CaptureSnapshot());
+
+			if (++TickIndex >= TicksPerScenario)
+			{
+				EndScenario(Scenario);
+			}
+
+			return true;
+		}
+
+	private:
+		void BeginScenario(const FScenario& Scenario)
+		{
+			FGeometryBuilder Builder;
+			Builder.World = World.Get();
+			Builder.Cube = Cube.Get();
+			Builder.SpawnedActors = &SpawnedActors;
+			Scenario.BuildGeometry(Builder);
+
+			const FTransform StartTransform(BenchOrigin + Scenario.StartLocation);
+			ASkully* Skully = World->SpawnActorDeferred<ASkully>(ASkully::StaticClass(), StartTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			if (Skully == nullptr)
+			{
+				++ScenarioIndex;
+				CleanupScenario();
+				return;
+			}
+
+			// 플레이어 컨트롤러가 빙의하지 않도록 함
+			Skully->AutoPossessPlayer = EAutoReceiveInput::Disabled;
+			Skully->FinishSpawning(StartTransform);
+			SpawnedActors.Add(Skully);
+
+			Movement = Skully->FindComponentByClass<USkullyMovementComponent>();
+			if (Movement.IsValid() == false)
+			{
+				++ScenarioIndex;
+				CleanupScenario();
+				return;
+			}
+
+			// 벤치마크가 직접 틱을 넣음
+			Movement->SetComponentTickEnabled(false);
+			Movement->ResetQueryCounters();
+
+			TickIndex = 0;
+			TickNs.Reset(TicksPerScenario);
+			States.Reset(TicksPerScenario);
+			
+			if (bUseRecordedInput == true)
+			{
+				InputReplayer.Start(RecordedInput);
+			}
+		}
+
+		void EndScenario(const FScenario& Scenario)
+		{
+			FScenarioResult Result;
+			Result.Name = Scenario.Name;
+			Result.NumTicks = TickNs.Num();
+
+			TickNs.Sort();
+			double TotalNs = 0.0;
+			for (const double Ns : TickNs)
+			{
+				TotalNs += Ns;
+			}
+
+			if (TickNs.Num() > 0)
+			{
+				Result.AvgNsPerTick = TotalNs / TickNs.Num();
+				Result.P95NsPerTick = TickNs[FMath::Min(TickNs.Num() - 1, FMath::FloorToInt(TickNs.Num() * 0.95f))];
+				Result.MaxNsPerTick = TickNs.Last();
+				Result.QueriesPerTick = static_cast<double>(Movement->GetQueryCounters().GetTotal()) / TickNs.Num();
+			}
+
+			Result.FinalLocation = Movement->UpdatedComponent->GetComponentLocation() - BenchOrigin;
+			Result.Checksum = ComputeChecksum(Result.FinalLocation);
+			MeasureStateBandwidth(States, Result);
+
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] %-12s ticks=%d avg=%.0fns p95=%.0fns max=%.0fns queries/tick=%.2f final=(%.2f, %.2f, %.2f) checksum=%08X"),
+				*Result.Name, Result.NumTicks, Result.AvgNsPerTick, Result.P95NsPerTick, Result.MaxNsPerTick, Result.QueriesPerTick,
+				Result.FinalLocation.X, Result.FinalLocation.Y, Result.FinalLocation.Z, Result.Checksum);
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] %-12s state bytes: naive=%.1f keyframe=%.1f delta=%.1f (%.1fx)"),
+				*Result.Name, Result.NaiveStateBytes, Result.KeyframeStateBytes, Result.DeltaStateBytes,
+				Result.DeltaStateBytes > 0.0 ? Result.NaiveStateBytes / Result.DeltaStateBytes : 0.0);
+
+			Results.Add(Result);
+
+			++ScenarioIndex;
+			CleanupScenario();
+		}
+
+		void CleanupScenario()
+		{
+			for (const TWeakObjectPtr<AActor>& Actor : SpawnedActors)
+			{
+				if (Actor.IsValid() == true)
+				{
+					Actor->Destroy();
+				}
+			}
+
+			SpawnedActors.Reset();
+			Movement.Reset();
+		}
+
+		void Finish()
+		{
+			FString Csv = TEXT("Scenario,Ticks,DeltaTime,AvgNs,P95Ns,MaxNs,QueriesPerTick,FinalX,FinalY,FinalZ,Checksum,NaiveStateBytes,KeyframeStateBytes,DeltaStateBytes\n");
+			for (const FScenarioResult& Result : Results)
+			{
+				Csv += FString::Printf(TEXT("%s,%d,%f,%.0f,%.0f,%.0f,%.3f,%.2f,%.2f,%.2f,%08X,%.1f,%.2f,%.2f\n"),
+					*Result.Name, Result.NumTicks, DeltaTime, Result.AvgNsPerTick, Result.P95NsPerTick, Result.MaxNsPerTick, Result.QueriesPerTick,
+					Result.FinalLocation.X, Result.FinalLocation.Y, Result.FinalLocation.Z, Result.Checksum,
+					Result.NaiveStateBytes, Result.KeyframeStateBytes, Result.DeltaStateBytes);
+			}
+
+			const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("SkullyBench") / TEXT("MovementBench.csv");
+			FFileHelper::SaveStringToFile(Csv, *CsvPath);
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] 완료: %d개 시나리오, 결과 파일 %s"), Results.Num(), *CsvPath);
+
+			if (bQuitWhenDone == true)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+		}
+
+	private:
+		TWeakObjectPtr<UWorld> World;
+		// 시나리오 사이(프레임 경계)에서 GC되지 않도록 유지
+		TStrongObjectPtr<UStaticMesh> Cube;
+
+		int32 TicksPerScenario = 600;
+		float DeltaTime = 1.0f / 60.0f;
+		bool bQuitWhenDone = false;
+
+		int32 ScenarioIndex = 0;
+		int32 TickIndex = 0;
+		TWeakObjectPtr<USkullyMovementComponent> Movement;
+		TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+		TArray<double> TickNs;
+		TArray<FSkullyMovementSnapshot> States;
+		TArray<FScenarioResult> Results;
+		
+		// 녹화된 입력 재생
+		bool bUseRecordedInput = false;
+		FSkullyInputStream RecordedInput;
+		FSkullyInputReplayer InputReplayer;
+	};
+
+	TUniquePtr<FRunner> ActiveRunner;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		if (ActiveRunner.IsValid() == true)
+		{
+			UE_LOG(LogSkullyMovement, Warning, TEXT("[Bench] 이미 실행 중입니다."));
+			return;
+		}
+
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		const int32 Ticks = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 600;
+		const float DeltaTime = Args.Num() > 1 ? FMath::Max(FCString::Atof(*Args[1]), 0.001f) : 1.0f / 60.0f;
+		const bool bQuit = Args.Contains(TEXT("quit"));
+		
+		FSkullyInputStream RecordedInput;
+		for (const FString& Arg : Args)
+		{
+			FString InputName;
+			if (Arg.Split(TEXT("input="), nullptr, &InputName) == true)
+			{
+				const FString FilePath = FSkullyInputStream::ResolveFilePath(InputName);
+				if (RecordedInput.LoadFromFile(FilePath) == false)
+				{
+					UE_LOG(LogSkullyMovement, Error, TEXT("[Bench] 입력 파일을 읽을 수 없습니다: %s"), *FilePath);
+					return;
+				}
+			}
+		}
+
+		UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] 시작: 시나리오당 %d틱, DeltaTime %.4f"), Ticks, DeltaTime);
+
+		ActiveRunner = MakeUnique<FRunner>(World, Ticks, DeltaTime, bQuit, &RecordedInput);
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			if (ActiveRunner.IsValid() == true && ActiveRunner->Tick() == true)
+			{
+				return true;
+			}
+
+			ActiveRunner.Reset();
+			return false;
+		}));
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs RunCommand(
+		TEXT("Skully.Bench.Movement"),
+		TEXT("USkullyMovementComponent 벤치마크: Skully.Bench.Movement [시나리오당 틱 수=600] [DeltaTime=0.016667] [input=녹화 이름/경로] [quit]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run));
+
+	/**
+	 * 배치 시뮬레이터 러너
+	 * 첫 프레임에 지형을 만들고(씬 쿼리에 반영되도록 한 프레임 대기), 이후 프레임마다 바디 수 하나씩 측정한다.
+	 */
+	class FBatchRunner
+	{
+	public:
+		FBatchRunner(UWorld* InWorld, const TArray<int32>& InBodyCounts, int32 InNumSteps, bool bInQuitWhenDone)
+			: World(InWorld), BodyCounts(InBodyCounts), NumSteps(InNumSteps), bQuitWhenDone(bInQuitWhenDone)
+		{
+			Cube.Reset(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		}
+
+		~FBatchRunner()
+		{
+			for (const TWeakObjectPtr<AActor>& Actor : SpawnedActors)
+			{
+				if (Actor.IsValid() == true)
+				{
+					Actor->Destroy();
+				}
+			}
+
+			if (USkullyBodyBatchSubsystem* Batch = GetBatch())
+			{
+				Batch->bAutoStep = bPrevAutoStep;
+			}
+		}
+
+		// 한 프레임 진행, 모든 측정이 끝나면 false
+		bool Tick()
+		{
+			USkullyBodyBatchSubsystem* Batch = GetBatch();
+			if (Batch == nullptr || Cube.IsValid() == false)
+			{
+				UE_LOG(LogSkullyMovement, Error, TEXT("[Bench] World/배치 서브시스템 또는 테스트 메시가 없어 벤치마크를 중단합니다."));
+				return false;
+			}
+
+			if (bGeometryBuilt == false)
+			{
+				FGeometryBuilder Builder;
+				Builder.World = World.Get();
+				Builder.Cube = Cube.Get();
+				Builder.SpawnedActors = &SpawnedActors;
+				BuildRidge(Builder);
+
+				// 측정 중에는 서브시스템 Tick이 끼어들지 않도록 함
+				bPrevAutoStep = Batch->bAutoStep;
+				Batch->bAutoStep = false;
+				bGeometryBuilt = true;
+				return true;
+			}
+
+			if (CountIndex >= BodyCounts.Num())
+			{
+				Finish();
+				return false;
+			}
+
+			Measure(*Batch, BodyCounts[CountIndex++]);
+			return true;
+		}
+
+	private:
+		USkullyBodyBatchSubsystem* GetBatch() const
+		{
+			return World.IsValid() == true ? World->GetSubsystem<USkullyBodyBatchSubsystem>() : nullptr;
+		}
+
+		void Measure(USkullyBodyBatchSubsystem& Batch, int32 NumBodies)
+		{
+			// 능선 위 격자에 배치, 절반은 입력 없이 굴러떨어지고 절반은 바디마다 다른 방향으로 이동
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumBodies)));
+			const float Spacing = 4000.0f / FMath::Max(GridSize, 1);
+
+			TArray<int32> BodyIds;
+			BodyIds.Reserve(NumBodies);
+			for (int32 Index = 0; Index < NumBodies; ++Index)
+			{
+				const float X = (Index % GridSize + 0.5f) * Spacing - 2000.0f;
+				const float Y = (Index / GridSize + 0.5f) * Spacing - 2000.0f;
+				const int32 BodyId = Batch.AddBody(BenchOrigin + FVector(X, Y, 600.0f), 50.0f);
+
+				if (Index % 2 == 1)
+				{
+					// 황금각으로 방향을 흩뿌림
+					const float Angle = Index * 2.39996f;
+					Batch.SetBodyInput(BodyId, FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f));
+				}
+
+				BodyIds.Add(BodyId);
+			}
+
+			const float DeltaTime = Batch.FixedTimestep;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				Batch.StepBodies(DeltaTime);
+			}
+			const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			FBatchResult Result;
+			Result.NumBodies = NumBodies;
+			Result.StepsPerSec = Seconds > 0.0 ? NumSteps / Seconds : 0.0;
+			Result.BodyStepsPerSec = Result.StepsPerSec * NumBodies;
+			Result.UsPerStep = NumSteps > 0 ? Seconds * 1.0e6 / NumSteps : 0.0;
+
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Batch bodies=%-5d steps=%d us/step=%.1f steps/sec=%.1f body-steps/sec=%.0f"),
+				Result.NumBodies, NumSteps, Result.UsPerStep, Result.StepsPerSec, Result.BodyStepsPerSec);
+
+			Results.Add(Result);
+
+			// 벤치마크가 추가한 바디만 제거(게임이 쓰던 바디는 유지)
+			for (const int32 BodyId : BodyIds)
+			{
+				Batch.RemoveBody(BodyId);
+			}
+		}
+
+		void Finish()
+		{
+			FString Csv = TEXT("Bodies,Steps,UsPerStep,StepsPerSec,BodyStepsPerSec\n");
+			for (const FBatchResult& Result : Results)
+			{
+				Csv += FString::Printf(TEXT("%d,%d,%.1f,%.1f,%.0f\n"), Result.NumBodies, NumSteps, Result.UsPerStep, Result.StepsPerSec, Result.BodyStepsPerSec);
+			}
+
+			const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("SkullyBench") / TEXT("BatchBench.csv");
+			FFileHelper::SaveStringToFile(Csv, *CsvPath);
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Batch 완료: 결과 파일 %s"), *CsvPath);
+
+			if (bQuitWhenDone == true)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+		}
+
+	private:
+		struct FBatchResult
+		{
+			int32 NumBodies = 0;
+			double UsPerStep = 0.0;
+			double StepsPerSec = 0.0;
+			double BodyStepsPerSec = 0.0;
+		};
+
+		TWeakObjectPtr<UWorld> World;
+		TStrongObjectPtr<UStaticMesh> Cube;
+
+		TArray<int32> BodyCounts;
+		int32 NumSteps = 300;
+		bool bQuitWhenDone = false;
+
+		bool bGeometryBuilt = false;
+		bool bPrevAutoStep = true;
+		int32 CountIndex = 0;
+		TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+		TArray<FBatchResult> Results;
+	};
+
+	TUniquePtr<FBatchRunner> ActiveBatchRunner;
+
+	void RunBatch(const TArray<FString>& Args, UWorld* World)
+	{
+		if (ActiveBatchRunner.IsValid() == true)
+		{
+			UE_LOG(LogSkullyMovement, Warning, TEXT("[Bench] Batch 벤치마크가 이미 실행 중입니다."));
+			return;
+		}
+
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		TArray<int32> BodyCounts = { 100, 1000, 5000 };
+		if (Args.Num() > 0 && Args[0] != TEXT("quit"))
+		{
+			TArray<FString> Tokens;
+			Args[0].ParseIntoArray(Tokens, TEXT(","));
+
+			BodyCounts.Reset();
+			for (const FString& Token : Tokens)
+			{
+				BodyCounts.Add(FMath::Max(FCString::Atoi(*Token), 1));
+			}
+		}
+
+		const int32 Steps = Args.Num() > 1 && Args[1] != TEXT("quit") ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 300;
+		const bool bQuit = Args.Contains(TEXT("quit"));
+
+		UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Batch 시작: 바디 수 %d종류, 측정당 %d스텝"), BodyCounts.Num(), Steps);
+
+		ActiveBatchRunner = MakeUnique<FBatchRunner>(World, BodyCounts, Steps, bQuit);
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			if (ActiveBatchRunner.IsValid() == true && ActiveBatchRunner->Tick() == true)
+			{
+				return true;
+			}
+
+			ActiveBatchRunner.Reset();
+			return false;
+		}));
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs RunBatchCommand(
+		TEXT("Skully.Bench.Batch"),
+		TEXT("USkullyBodyBatchSubsystem 벤치마크: Skully.Bench.Batch [바디 수 목록=100,1000,5000] [측정당 스텝 수=300] [quit]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunBatch));
+
+	/**
+	 * 움직이는 바닥 러너
+	 * 바닥 추적 끔/켬 두 번 측정한다. 측정마다 첫 프레임에 발판과 Skully를 만들고, 이후 프레임마다
+	 * 발판을 고정 DeltaTime만큼 옮긴 뒤 모든 Skully를 한 틱씩 진행한다(발판/Skully의 자체 Tick은 끔).
+	 */
+	class FPlatformRunner
+	{
+	public:
+		FPlatformRunner(UWorld* InWorld, int32 InNumPlatforms, int32 InNumTicks, bool bInQuitWhenDone)
+			: World(InWorld), NumPlatforms(InNumPlatforms), NumTicks(InNumTicks), bQuitWhenDone(bInQuitWhenDone)
+		{
+		}
+
+		~FPlatformRunner()
+		{
+			Cleanup();
+		}
+
+		// 한 프레임 진행, 모든 측정이 끝나면 false
+		bool Tick()
+		{
+			if (World.IsValid() == false)
+			{
+				return false;
+			}
+
+			if (Platforms.Num() == 0)
+			{
+				if (ModeIndex >= 2)
+				{
+					Finish();
+					return false;
+				}
+
+				Spawn(ModeIndex == 1);
+				return true;
+			}
+
+			++TickIndex;
+			const float Time = TickIndex * DeltaTime;
+			for (const TWeakObjectPtr<ASkullyMovingPlatform>& Platform : Platforms)
+			{
+				if (Platform.IsValid() == true)
+				{
+					Platform->UpdatePlatform(Time);
+				}
+			}
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (const TWeakObjectPtr<USkullyMovementComponent>& Movement : Movements)
+			{
+				if (Movement.IsValid() == true)
+				{
+					Movement->TickWithInput(DeltaTime, FVector::ZeroVector);
+				}
+			}
+			TotalNs += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) * 1.0e9;
+
+			if (TickIndex >= NumTicks)
+			{
+				EndMeasure();
+			}
+
+			return true;
+		}
+
+	private:
+		void Spawn(bool bTrackMovingBase)
+		{
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumPlatforms)));
+			const float Spacing = 1500.0f;
+
+			for (int32 Index = 0; Index < NumPlatforms; ++Index)
+			{
+				const FVector Center = BenchOrigin + FVector((Index % GridSize) * Spacing, (Index / GridSize) * Spacing, 0.0f);
+				ASkullyMovingPlatform* Platform = World->SpawnActor<ASkullyMovingPlatform>(ASkullyMovingPlatform::StaticClass(), FTransform(Center));
+				if (Platform == nullptr)
+				{
+					continue;
+				}
+
+				// 수평 왕복, 승강, 수평 왕복 + 요 회전을 번갈아 배치하고 위상을 흩뿌림
+				Platform->SetActorTickEnabled(false);
+				Platform->MoveOffset = Index % 3 == 1 ? FVector(0.0f, 0.0f, 400.0f) : FVector(0.0f, 400.0f, 0.0f);
+				Platform->RotationRate = Index % 3 == 2 ? FRotator(0.0f, 30.0f, 0.0f) : FRotator::ZeroRotator;
+				Platform->TimeOffset = Index * 0.37f;
+				Platform->UpdatePlatform(0.0f);
+				Platforms.Add(Platform);
+
+				// 발판 윗면(두께 50cm) 위에 Skully(반지름 95cm)를 올림
+				const FTransform SkullyTransform(Platform->GetActorLocation() + FVector(0.0f, 0.0f, 25.0f + 95.0f + 2.0f));
+				ASkully* Skully = World->SpawnActorDeferred<ASkully>(ASkully::StaticClass(), SkullyTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+				if (Skully == nullptr)
+				{
+					// 발판과 Skully 인덱스를 맞춤
+					Platforms.Pop();
+					Platform->Destroy();
+					continue;
+				}
+
+				Skully->AutoPossessPlayer = EAutoReceiveInput::Disabled;
+				Skully->FinishSpawning(SkullyTransform);
+				Skullies.Add(Skully);
+
+				if (USkullyMovementComponent* Movement = Skully->FindComponentByClass<USkullyMovementComponent>())
+				{
+					Movement->SetComponentTickEnabled(false);
+					Movement->bTrackMovingBase = bTrackMovingBase;
+					// 잠들면 쿼리가 사라져 추적 끔/켬 비교가 흐려지므로 끔
+					Movement->bEnableSleep = false;
+					Movement->ResetQueryCounters();
+					Movements.Add(Movement);
+				}
+			}
+
+			TickIndex = 0;
+			TotalNs = 0.0;
+		}
+
+		void EndMeasure()
+		{
+			FPlatformResult Result;
+			Result.bTrackMovingBase = ModeIndex == 1;
+			Result.NumBodies = Movements.Num();
+
+			uint64 MoveSweeps = 0;
+			uint64 GroundQueries = 0;
+			for (int32 Index = 0; Index < Movements.Num(); ++Index)
+			{
+				if (Movements[Index].IsValid() == false)
+				{
+					continue;
+				}
+
+				const FSkullyMovementQueryCounters& Counters = Movements[Index]->GetQueryCounters();
+				MoveSweeps += Counters.MoveSweeps;
+				GroundQueries += Counters.GroundSweeps + Counters.GroundLineTraces;
+
+				// 발판 윗면 영역 안, 발판보다 위에 있으면 남은 것으로 봄
+				if (Platforms.IsValidIndex(Index) == true && Platforms[Index].IsValid() == true)
+				{
+					const FVector Local = Platforms[Index]->GetActorTransform().InverseTransformPosition(Movements[Index]->UpdatedComponent->GetComponentLocation());
+					if (FMath::Abs(Local.X) <= 300.0f && FMath::Abs(Local.Y) <= 300.0f && Local.Z > 0.0f)
+					{
+						++Result.NumOnPlatform;
+					}
+				}
+			}
+
+			const double BodyTicks = FMath::Max(static_cast<double>(Result.NumBodies) * NumTicks, 1.0);
+			Result.UsPerTick = TotalNs / 1000.0 / FMath::Max(NumTicks, 1);
+			Result.MoveSweepsPerBodyTick = MoveSweeps / BodyTicks;
+			Result.GroundQueriesPerBodyTick = GroundQueries / BodyTicks;
+
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Platforms track=%d bodies=%d ticks=%d us/tick=%.1f move sweeps/body-tick=%.2f ground queries/body-tick=%.2f on platform=%d"),
+				Result.bTrackMovingBase ? 1 : 0, Result.NumBodies, NumTicks, Result.UsPerTick, Result.MoveSweepsPerBodyTick, Result.GroundQueriesPerBodyTick, Result.NumOnPlatform);
+
+			Results.Add(Result);
+			++ModeIndex;
+			Cleanup();
+		}
+
+		void Cleanup()
+		{
+			for (const TWeakObjectPtr<ASkully>& Skully : Skullies)
+			{
+				if (Skully.IsValid() == true)
+				{
+					Skully->Destroy();
+				}
+			}
+
+			for (const TWeakObjectPtr<ASkullyMovingPlatform>& Platform : Platforms)
+			{
+				if (Platform.IsValid() == true)
+				{
+					Platform->Destroy();
+				}
+			}
+
+			Skullies.Reset();
+			Platforms.Reset();
+			Movements.Reset();
+		}
+
+		void Finish()
+		{
+			FString Csv = TEXT("TrackMovingBase,Bodies,Ticks,UsPerTick,MoveSweepsPerBodyTick,GroundQueriesPerBodyTick,OnPlatform\n");
+			for (const FPlatformResult& Result : Results)
+			{
+				Csv += FString::Printf(TEXT("%d,%d,%d,%.1f,%.3f,%.3f,%d\n"), Result.bTrackMovingBase ? 1 : 0, Result.NumBodies, NumTicks,
+					Result.UsPerTick, Result.MoveSweepsPerBodyTick, Result.GroundQueriesPerBodyTick, Result.NumOnPlatform);
+			}
+
+			const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("SkullyBench") / TEXT("PlatformBench.csv");
+			FFileHelper::SaveStringToFile(Csv, *CsvPath);
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Platforms 완료: 결과 파일 %s"), *CsvPath);
+
+			if (bQuitWhenDone == true)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+		}
+
+	private:
+		struct FPlatformResult
+		{
+			bool bTrackMovingBase = false;
+			int32 NumBodies = 0;
+			double UsPerTick = 0.0;
+			double MoveSweepsPerBodyTick = 0.0;
+			double GroundQueriesPerBodyTick = 0.0;
+			int32 NumOnPlatform = 0;
+		};
+
+		TWeakObjectPtr<UWorld> World;
+		int32 NumPlatforms = 64;
+		int32 NumTicks = 600;
+		bool bQuitWhenDone = false;
+		const float DeltaTime = 1.0f / 60.0f;
+
+		// 0: 바닥 추적 끔, 1: 켬
+		int32 ModeIndex = 0;
+		int32 TickIndex = 0;
+		double TotalNs = 0.0;
+		TArray<TWeakObjectPtr<ASkullyMovingPlatform>> Platforms;
+		TArray<TWeakObjectPtr<ASkully>> Skullies;
+		TArray<TWeakObjectPtr<USkullyMovementComponent>> Movements;
+		TArray<FPlatformResult> Results;
+	};
+
+	TUniquePtr<FPlatformRunner> ActivePlatformRunner;
+
+	void RunPlatforms(const TArray<FString>& Args, UWorld* World)
+	{
+		if (ActivePlatformRunner.IsValid() == true)
+		{
+			UE_LOG(LogSkullyMovement, Warning, TEXT("[Bench] Platforms 벤치마크가 이미 실행 중입니다."));
+			return;
+		}
+
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		const int32 NumPlatforms = Args.Num() > 0 && Args[0] != TEXT("quit") ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 64;
+		const int32 Ticks = Args.Num() > 1 && Args[1] != TEXT("quit") ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 600;
+		const bool bQuit = Args.Contains(TEXT("quit"));
+
+		UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Platforms 시작: 발판 %d개, 측정당 %d틱"), NumPlatforms, Ticks);
+
+		ActivePlatformRunner = MakeUnique<FPlatformRunner>(World, NumPlatforms, Ticks, bQuit);
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			if (ActivePlatformRunner.IsValid() == true && ActivePlatformRunner->Tick() == true)
+			{
+				return true;
+			}
+
+			ActivePlatformRunner.Reset();
+			return false;
+		}));
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs RunPlatformsCommand(
+		TEXT("Skully.Bench.Platforms"),
+		TEXT("움직이는 바닥 추적 벤치마크: Skully.Bench.Platforms [발판 수=64] [측정당 틱 수=600] [quit]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunPlatforms));
+
+	// 커널 검증 허용 오차: 속도(cm/s)와 이동량(cm), float 연산과 double(FVector) 연산의 차이
+	constexpr float KernelVelocityTolerance = 0.05f;
+	constexpr float KernelMoveTolerance = 0.001f;
+	// 임계값 경계에서 슬라이딩 판정이 갈리는 레인 비율 허용치
+	constexpr double KernelMaxSlidingMismatchRate = 0.001;
+
+	void RandomizeKernelLanes(FRandomStream& Random, FSkullyMovementKernelLanes& Lanes)
+	{
+		for (int32 Lane = 0; Lane < FSkullyMovementKernelLanes::Width; ++Lane)
+		{
+			// 절반은 평지, 나머지는 최대 약 55도 경사, 직전 노멀은 가끔 크게 달라짐(엣지)
+			FVector CachedNormal = FVector::UpVector;
+			if (Random.FRand() < 0.5f)
+			{
+				const float Tilt = Random.FRandRange(0.0f, 0.95f);
+				const float Yaw = Random.FRandRange(0.0f, UE_TWO_PI);
+				CachedNormal = FVector(FMath::Cos(Yaw) * FMath::Sin(Tilt), FMath::Sin(Yaw) * FMath::Sin(Tilt), FMath::Cos(Tilt));
+			}
+
+			const FVector LastNormal = Random.FRand() < 0.2f
+				? (CachedNormal + Random.VRand() * 0.5f).GetSafeNormal()
+				: CachedNormal;
+
+			const FVector Velocity(Random.FRandRange(-3000.0f, 3000.0f), Random.FRandRange(-3000.0f, 3000.0f), Random.FRandRange(-500.0f, 500.0f));
+			const FVector Input = Random.FRand() < 0.5f ? FVector::ZeroVector : FVector(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f);
+
+			Lanes.SetLane(Lane, Velocity, CachedNormal, LastNormal, Input, Random.FRand() < 0.75f, Random.FRand() < 0.5f);
+		}
+	}
+
+	void RunKernel(const TArray<FString>& Args, UWorld* World)
+	{
+		const int32 NumBodies = Args.Num() > 0 && Args[0] != TEXT("quit") ? FMath::Max(FCString::Atoi(*Args[0]), FSkullyMovementKernelLanes::Width) : 4096;
+		const int32 NumSteps = Args.Num() > 1 && Args[1] != TEXT("quit") ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 200;
+		const bool bQuit = Args.Contains(TEXT("quit"));
+
+		const FSkullyMovementModelParams Params = GetDefault<USkullyMovementComponent>()->MakeModelParams();
+		const float DeltaTime = 1.0f / 60.0f;
+		const int32 NumGroups = FMath::DivideAndRoundUp(NumBodies, FSkullyMovementKernelLanes::Width);
+
+		FRandomStream Random(1234);
+		TArray<FSkullyMovementKernelLanes> Initial;
+		Initial.SetNum(NumGroups);
+		for (FSkullyMovementKernelLanes& Lanes : Initial)
+		{
+			RandomizeKernelLanes(Random, Lanes);
+		}
+
+		// 1) 허용 오차 검증: 매 스텝 같은 입력(스칼라 결과를 다음 스텝 입력으로 사용)으로 두 경로를 실행해 비교
+		float MaxVelocityError = 0.0f;
+		float MaxMoveError = 0.0f;
+		int64 SlidingMismatches = 0;
+		int64 ComparedLanes = 0;
+		{
+			TArray<FSkullyMovementKernelLanes> State = Initial;
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				for (FSkullyMovementKernelLanes& Lanes : State)
+				{
+					FSkullyMovementKernelLanes Simd = Lanes;
+					SkullyMovementKernel::StepVelocitiesScalar(Lanes, Params, DeltaTime);
+					SkullyMovementKernel::StepVelocitiesSimd(Simd, Params, DeltaTime);
+
+					for (int32 Lane = 0; Lane < FSkullyMovementKernelLanes::Width; ++Lane)
+					{
+						++ComparedLanes;
+						if (Lanes.IsSliding(Lane) != Simd.IsSliding(Lane))
+						{
+							// 임계값 경계에서 갈린 레인은 속도 차이가 커도 오차 집계에서 제외
+							++SlidingMismatches;
+							continue;
+						}
+
+						MaxVelocityError = FMath::Max(MaxVelocityError, static_cast<float>((Lanes.GetVelocity(Lane) - Simd.GetVelocity(Lane)).GetAbsMax()));
+						MaxMoveError = FMath::Max(MaxMoveError, static_cast<float>((Lanes.GetMoveDelta(Lane) - Simd.GetMoveDelta(Lane)).GetAbsMax()));
+					}
+
+					// 정지/착지가 반복되면 상태가 한쪽으로 모이므로 가끔 새 무작위 상태로 교체
+					if (Random.FRand() < 0.05f)
+					{
+						RandomizeKernelLanes(Random, Lanes);
+					}
+				}
+			}
+		}
+
+		const double MismatchRate = ComparedLanes > 0 ? static_cast<double>(SlidingMismatches) / ComparedLanes : 0.0;
+		const bool bPassed = MaxVelocityError <= KernelVelocityTolerance && MaxMoveError <= KernelMoveTolerance && MismatchRate <= KernelMaxSlidingMismatchRate;
+
+		// 2) 시간 측정: 같은 초기 상태에서 각 경로만 반복
+		auto MeasureNs = [&Initial, &Params, DeltaTime, NumSteps](void (*StepFunc)(FSkullyMovementKernelLanes&, const FSkullyMovementModelParams&, float))
+		{
+			TArray<FSkullyMovementKernelLanes> State = Initial;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				for (FSkullyMovementKernelLanes& Lanes : State)
+				{
+					StepFunc(Lanes, Params, DeltaTime);
+				}
+			}
+			const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			return Seconds * 1.0e9 / (static_cast<double>(State.Num()) * FSkullyMovementKernelLanes::Width * NumSteps);
+		};
+
+		const double ScalarNs = MeasureNs(&SkullyMovementKernel::StepVelocitiesScalar);
+		const double SimdNs = MeasureNs(&SkullyMovementKernel::StepVelocitiesSimd);
+
+		UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Kernel bodies=%d steps=%d scalar ns/body=%.2f simd ns/body=%.2f speedup=%.2fx"),
+			NumGroups * FSkullyMovementKernelLanes::Width, NumSteps, ScalarNs, SimdNs, SimdNs > 0.0 ? ScalarNs / SimdNs : 0.0);
+		UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Kernel %s: 최대 속도 오차 %.5f(허용 %.3f), 최대 이동량 오차 %.6f(허용 %.4f), 슬라이딩 판정 불일치 %lld/%lld"),
+			bPassed ? TEXT("PASS") : TEXT("FAIL"), MaxVelocityError, KernelVelocityTolerance, MaxMoveError, KernelMoveTolerance, SlidingMismatches, ComparedLanes);
+
+		FString Csv = TEXT("Bodies,Steps,ScalarNsPerBody,SimdNsPerBody,MaxVelocityError,MaxMoveError,SlidingMismatches,Result\n");
+		Csv += FString::Printf(TEXT("%d,%d,%.2f,%.2f,%.5f,%.6f,%lld,%s\n"), NumGroups * FSkullyMovementKernelLanes::Width, NumSteps, ScalarNs, SimdNs,
+			MaxVelocityError, MaxMoveError, SlidingMismatches, bPassed ? TEXT("PASS") : TEXT("FAIL"));
+
+		const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("SkullyBench") / TEXT("KernelBench.csv");
+		FFileHelper::SaveStringToFile(Csv, *CsvPath);
+		UE_LOG(LogSkullyMovement, Display, TEXT("[Bench] Kernel 완료: 결과 파일 %s"), *CsvPath);
+
+		if (bQuit == true)
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs RunKernelCommand(
+		TEXT("Skully.Bench.Kernel"),
+		TEXT("이동 모델 커널 스칼라/SIMD 비교 및 벤치마크: Skully.Bench.Kernel [바디 수=4096] [스텝 수=200] [quit]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunKernel));
+}
+
+#endif
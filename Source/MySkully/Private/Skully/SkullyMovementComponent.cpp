@@ -4,294 +4,810 @@
 #include "Skully/SkullyMovementComponent.h"
 
 #include "Components/SphereComponent.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeExit.h"
+#include "MySkully.h"
+#include "Net/UnrealNetwork.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Skully/SkullyAsyncMovementSubsystem.h"
+#include "Skully/SkullyGimmickSubsystem.h"
+#include "Skully/SkullyMovementModel.h"
+#include "Skully/SkullyMovementStats.h"
+#include "Skully/SkullyWalkabilitySubsystem.h"
 
 namespace
 {
-	bool TryGetDownhillDirFromSamples(UWorld* World, const FVector& Origin, float SampleDist, float TraceDown, AActor* IgnoreActor, FVector& OutDir);
+	// 바닥 반응 캐시 최대 항목 수(넘으면 비움, 스트리밍으로 사라진 바닥이 계속 쌓이지 않도록)
+	constexpr int32 MaxSurfaceResponseCacheEntries = 64;
 }
 
 USkullyMovementComponent::USkullyMovementComponent()
 {
 	// 이 컴포넌트는 매 Tick마다 자체 물리(중력/마찰/이동/지면판정)를 처리한다
 	PrimaryComponentTick.bCanEverTick = true;
+
+	// 예측 RPC/이동 상태 복제
+	SetIsReplicatedByDefault(true);
+}
+
+void USkullyMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// 입력을 가진 클라이언트는 ClientAdjustMove로만 보정받으므로 시뮬레이티드 프록시에만 복제
+	DOREPLIFETIME_CONDITION(USkullyMovementComponent, ReplicatedState, COND_SimulatedOnly);
 }
 
 void USkullyMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
                                              FActorComponentTickFunction* ThisTickFunction)
 {
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyMovementTick, SkullyMovement_Tick);
+	
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	if (UpdatedComponent == nullptr || ShouldSkipUpdate(DeltaTime) == true)
 	{
 		return;
 	}
+	
+	// 프레임 처리 중의 보간 오프셋 변경은 모아 두었다가 구르기 회전과 함께 한 번에 적용
+	bDeferVisualUpdate = true;
+	ON_SCOPE_EXIT
+	{
+		bDeferVisualUpdate = false;
+		UpdateRollingVisual(DeltaTime);
+	};
 
-	// 중력 적용(Falling일 때만 Z 하강(아래로 가속))
-	ApplyGravity(DeltaTime);
-	// 경사면에서 정지 시 미끄러짐(굴러떨어짐) 적용
-	bSlopeSlideAppliedThisFrame = ApplySlopeSlide(DeltaTime);
-	// 마찰 적용(XY 감속(XY 속도를 줄여 미끄러짐/관성을 제어))
-	ApplyFriction(DeltaTime, bSlopeSlideAppliedThisFrame ? SlidingFriction : GroundFriction);
-	// 이동 처리(Sweep 기반 이동 + 충돌 처리(입력 기반 + 경사 투영 + 불안정 바닥 처리))
-	Move(DeltaTime);
-	// 지면 판정(Sweep + LineTrace로 Grounded/Falling 갱신)
-	// Move()가 먼저 움직인 뒤, CheckGround()가 새 위치에서 바닥 상태를 확정
-	CheckGround(DeltaTime);
-	// 이동 상태값(현재 속력, 방향 등) 갱신
-	UpdateMotionState();
-}
+	// 이번 프레임의 입력을 한 번만 소비(서브스텝 모드에서는 모든 서브스텝이 같은 입력을 사용)
+	const FVector Input = ConsumeMovementInput();
 
-// 중력 적용
-void USkullyMovementComponent::ApplyGravity(float DeltaTime)
-{
-	// Falling일 때만 중력 가속을 적용해서 낙하
-	if (MovementMode == ESkullyMovementMode::Falling)
+	// 비동기 물리 모드: 물리 스레드가 이동하고 여기서는 입력 전달과 결과 보간만
+	if (ShouldUseAsyncPhysics() == true)
 	{
-		Velocity.Z -= Gravity * DeltaTime;
+		TickAsyncPhysics(Input);
+		return;
 	}
-	// Grounded 상태에서는 중력으로 바닥을 파고들지 않도록 Z 속도를 최소 0으로 유지
-	else
+	StopAsyncPhysics();
+
+	if (PawnOwner != nullptr && GetNetMode() != NM_Standalone)
 	{
-		Velocity.Z = FMath::Max(Velocity.Z, 0.0f);
+		switch (PawnOwner->GetLocalRole())
+		{
+		case ROLE_AutonomousProxy:
+			TickAutonomousProxy(DeltaTime, Input);
+			UpdateNetSmoothing(DeltaTime);
+			return;
+		case ROLE_SimulatedProxy:
+			TickSimulatedProxy(DeltaTime);
+			UpdateNetSmoothing(DeltaTime);
+			return;
+		default:
+			break;
+		}
+
+		// 서버의 원격 플레이어 폰은 ServerMove로만 이동
+		if (PawnOwner->IsPlayerControlled() == true && PawnOwner->IsLocallyControlled() == false)
+		{
+			return;
+		}
+
+		PerformMove(DeltaTime, Input);
+		UpdateReplicatedState();
+		return;
 	}
+
+	PerformMove(DeltaTime, Input);
 }
 
-// 경사면 미끄러짐 적용: 플레이어가 가만히 있는데 경사가 있으면 굴러떨어지는 전용 로직
-bool USkullyMovementComponent::ApplySlopeSlide(float DeltaTime)
+void USkullyMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// 기본 전제: Grounded + 입력 없음일 때만 정지 후 굴러떨어짐을 평가한다.
-	if (MovementMode != ESkullyMovementMode::Grounded || GetPendingInputVector().IsNearlyZero() == false)
+	UnbindSleepWatchers();
+	if (bIsAsleep == true)
 	{
-		bIsSlopeSliding = false;
-		return false;
+		bIsAsleep = false;
+		DEC_DWORD_STAT(STAT_SkullySleepingBodies);
 	}
 	
-	const FVector GravityVector(0.0f, 0.0f, -Gravity);
-	// 불안정 바닥에서는 CachedFloorNormal이 튀는 프레임이 있으므로, 슬라이드에 사용할 노멀을 안정화하여 UseNormal에 적용
-	const float NormalDot = FVector::DotProduct(CachedFloorNormal, LastFloorNormal);
-	const bool bUnstableFloor = CachedFloorNormal.Z < UnstableFloorZThreshold || NormalDot < FloorNormalDotEdgeThreshold;
-	FVector UseNormal = bUnstableFloor ? LastFloorNormal : CachedFloorNormal;
-	UseNormal = UseNormal.GetSafeNormal();
-	// 중력 벡터를 바닥 평면에 투영하여 미끄러짐 생성
-	FVector AlongPlane = FVector::VectorPlaneProject(GravityVector, UseNormal);
+	FlushSurfaceResponseCache();
+	StopAsyncPhysics();
 	
-	// 상각형 경계, 플랫폼 끝, 경사-평지 전환 등으로 노멀이 애매해서 AlongPlane이 거의 0이면
-	if (AlongPlane.SizeSquared() < KINDA_SMALL_NUMBER)
+	if (bHasGimmickCell == true)
 	{
-		FVector DownhillDir;
-		// 주변 바닥 높이를 샘플링해서 진짜 내리막 방향(downhill)을 추정
-		if (UseNormal.Z < MinSlopeForSamplesZ && 
-			TryGetDownhillDirFromSamples(GetWorld(), UpdatedComponent->GetComponentLocation(), DownhillSampleDistance, GroundLineTraceDistance + 50.0f, GetOwner(), DownhillDir))
+		if (USkullyGimmickSubsystem* Gimmicks = GetWorld()->GetSubsystem<USkullyGimmickSubsystem>())
 		{
-			AlongPlane = DownhillDir * Gravity;
-		}
-		else
-		{
-			bIsSlopeSliding = false;
-			return false;
+			Gimmicks->RemoveBody(this);
 		}
+		bHasGimmickCell = false;
 	}
-		
-	// 슬라이드 가속 스케일 적용
-	FVector SlideAccel = AlongPlane * SlopeSlideScale;
-	const float SlideAccelMag = SlideAccel.Size();
 	
-	if (SlideAccelMag <= KINDA_SMALL_NUMBER)
+	Super::EndPlay(EndPlayReason);
+}
+
+void USkullyMovementComponent::AddInputVector(FVector WorldVector, bool bForce)
+{
+	Super::AddInputVector(WorldVector, bForce);
+	
+	if (WorldVector.IsNearlyZero() == false)
 	{
-		bIsSlopeSliding = false;
-		return false;
+		WakeUp();
+	}
+}
+
+// 외부 드라이버(벤치마크/입력 리플레이)가 입력과 시간 간격을 직접 지정해서 한 프레임 진행
+// 컴포넌트 Tick은 꺼 두고 사용해야 같은 입력에 같은 결과가 나온다
+void USkullyMovementComponent::TickWithInput(float DeltaTime, const FVector& WorldInput)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyMovementTick, SkullyMovement_Tick);
+	
+	if (UpdatedComponent == nullptr || DeltaTime <= 0.0f)
+	{
+		return;
 	}
 	
-	const FVector SlideDir = SlideAccel.GetSafeNormal();
+	bDeferVisualUpdate = true;
+	ON_SCOPE_EXIT
+	{
+		bDeferVisualUpdate = false;
+		UpdateRollingVisual(DeltaTime);
+	};
 	
-	// 슬라이딩 종료(히스테리시스): 슬라이딩 상태일 때 가속이 너무 작으면 시작 안함
-	const float StopThreshold = StaticFrictionAccel * 0.5f;
-	if (bIsSlopeSliding == true && SlideAccelMag < StopThreshold)
+	// 쌓여 있던 입력은 버리고 지정한 입력만 사용
+	ConsumeInputVector();
+	PerformMove(DeltaTime, WorldInput.IsNearlyZero() ? FVector::ZeroVector : WorldInput.GetClampedToMaxSize(1.0f));
+}
+
+bool USkullyMovementComponent::ShouldUseAsyncPhysics() const
+{
+	// 네트워크 예측/보정은 게임 스레드 SimulateStep 재시뮬레이션에 의존하므로 단독 실행에서만 사용
+	return bUseAsyncPhysics == true && GetNetMode() == NM_Standalone && Cast<USphereComponent>(UpdatedComponent) != nullptr;
+}
+
+// 비동기 물리 모드의 한 프레임: 입력/파라미터 전달 -> 물리 스레드 결과(보간된 위치)를 컴포넌트에 적용
+void USkullyMovementComponent::TickAsyncPhysics(const FVector& Input)
+{
+	USkullyAsyncMovementSubsystem* AsyncMovement = GetWorld()->GetSubsystem<USkullyAsyncMovementSubsystem>();
+	if (AsyncMovement == nullptr)
 	{
-		bIsSlopeSliding = false;
-		return false;
+		return;
 	}
 	
-	// 시작(Static friction): 아직 슬라이딩 중이 아니면 정지 마찰을 이겨야 시작
-	bool bStartedSlidingThisFrame = false;
-	if (bIsSlopeSliding == false)
+	if (AsyncBodyId == INDEX_NONE)
 	{
-		if (SlideAccelMag <= StaticFrictionAccel)
+		// 잠든 상태로 들어오지 않도록 깨우고 시작(물리 스레드 이동은 휴면 없음)
+		WakeUp();
+		
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SkullyAsyncMove), false);
+		QueryParams.AddIgnoredActor(GetOwner());
+		AsyncBodyId = AsyncMovement->AddBody(MakeKernelBodyState(), Cast<USphereComponent>(UpdatedComponent)->GetScaledSphereRadius(), QueryParams);
+		if (AsyncBodyId == INDEX_NONE)
 		{
-			// 정지 마찰이 이기면 슬라이드 시작을 허용하지 않는다.
-			// 여기서 Velocity를 0으로 강제하면(특히 엣지/경계에서 노멀이 흔들릴 때)
-			// 속도 리셋 -> 다음 프레임 보정 이동같은 에너지 폭발이 생길 수 있어 건드리지 않는다.	
-			return false;
+			return;
 		}
-		
-		// 여기까지 왔으면 미끄러지기 시작
-		bIsSlopeSliding = true;
-		bStartedSlidingThisFrame = true;
 	}
 	
-	// 슬라이드 적용 전(이번 프레임 시작 시점)의 수평 속도
-	const FVector Vel2DBefore(Velocity.X, Velocity.Y, 0.f);
-	const bool bWasNearlyZero = (Vel2DBefore.SizeSquared() < FMath::Square(1.0f));
+	FrameInput = Input;
+	AsyncMovement->SetBodyInput(AsyncBodyId, Input, MakeModelParams());
 	
-	// 유지(Kinetic friction): 정지 마찰을 이긴 만큼만 가속(부드러운 시작)
-	Velocity.X += SlideDir.X * SlideAccelMag * DeltaTime;
-	Velocity.Y += SlideDir.Y * SlideAccelMag * DeltaTime;
+	FSkullyKernelBodyState State;
+	if (AsyncMovement->GetBodyState(AsyncBodyId, State) == false)
+	{
+		return;
+	}
 	
-	// 아주 작은 속도에서 한 프레임 멈칫하는 현상 방지: 최소 시작 속도 보장
-	if (bStartedSlidingThisFrame == true && bWasNearlyZero == true)
+	// 물리 스레드가 이미 충돌을 처리한 위치이므로 Sweep 없이 이동
+	UpdatedComponent->SetWorldLocation(State.Position, false, nullptr, ETeleportType::None);
+	Velocity = State.Velocity;
+	CachedFloorNormal = State.CachedFloorNormal;
+	LastFloorNormal = State.LastFloorNormal;
+	MovementMode = State.bGrounded ? ESkullyMovementMode::Grounded : ESkullyMovementMode::Falling;
+	bIsSlopeSliding = State.bIsSlopeSliding;
+	UpdateMotionState();
+}
+
+void USkullyMovementComponent::StopAsyncPhysics()
+{
+	if (AsyncBodyId == INDEX_NONE)
 	{
-		FVector Velocity2D(Velocity.X, Velocity.Y, 0.0f);
-		const float Speed2D = Velocity2D.Size();
-		
-		if (Speed2D > KINDA_SMALL_NUMBER && Speed2D < MinSlopeSlideStartSpeed)
-		{
-			Velocity2D = SlideDir * MinSlopeSlideStartSpeed;
-			Velocity.X = Velocity2D.X;
-			Velocity.Y = Velocity2D.Y;
-		}
+		return;
 	}
 	
-	// 속도 제한
-	FVector Velocity2D(Velocity.X, Velocity.Y, 0.0f);
-	Velocity2D = Velocity2D.GetClampedToMaxSize(MaxSlopeSlideSpeed);
-	Velocity.X = Velocity2D.X;
-	Velocity.Y = Velocity2D.Y;
+	if (USkullyAsyncMovementSubsystem* AsyncMovement = GetWorld()->GetSubsystem<USkullyAsyncMovementSubsystem>())
+	{
+		AsyncMovement->RemoveBody(AsyncBodyId);
+	}
+	AsyncBodyId = INDEX_NONE;
 	
-	return true;
+	// 게임 스레드 이동으로 돌아가면 바닥을 새 위치 기준으로 다시 쿼리
+	InvalidateGroundQueryCache();
 }
 
-// 마찰 적용
-void USkullyMovementComponent::ApplyFriction(float DeltaTime, float GroundedFriction)
+FSkullyKernelBodyState USkullyMovementComponent::MakeKernelBodyState() const
 {
-	// Grounded/Air 상태에 따라 마찰 계수 다르게 사용
-	float Friction = (MovementMode == ESkullyMovementMode::Grounded) ? GroundedFriction : AirFriction;
+	FSkullyKernelBodyState State;
+	State.Position = UpdatedComponent != nullptr ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
+	State.Velocity = Velocity;
+	State.CachedFloorNormal = CachedFloorNormal;
+	State.LastFloorNormal = LastFloorNormal;
+	State.bGrounded = MovementMode == ESkullyMovementMode::Grounded;
+	State.bIsSlopeSliding = bIsSlopeSliding;
 	
-	FVector HorizontalVelocity(Velocity.X, Velocity.Y, 0.0f);
+	return State;
+}
+
+// 입력 소비 이후 한 프레임 이동(잠든 상태 처리 포함)
+void USkullyMovementComponent::PerformMove(float DeltaTime, const FVector& Input)
+{
+	FrameInput = Input;
+
+	// 잠든 상태(SleepTickInterval > 0)의 저주기 틱은 바닥 확인만 함
+	if (bIsAsleep == true && FrameInput.IsNearlyZero() == true)
+	{
+		TickAsleep();
+		return;
+	}
+
+	WakeUp();
+	AdvanceFrame(DeltaTime);
+}
 
-	if (HorizontalVelocity.IsNearlyZero() == false)
+// 입력 소비 이후의 한 프레임 처리(고정 스텝 또는 가변 스텝)
+void USkullyMovementComponent::AdvanceFrame(float DeltaTime)
+{
+	if (bUseFixedTimestep == true)
+	{
+		TickFixedTimestep(DeltaTime);
+	}
+	else
 	{
-		// 슬라이딩 중에는 고정 감속(브레이킹) 대신 속도 비례 감쇠(댐핑)를 사용한다.
-		// 고정 감속은 저속에서 0으로 스냅되며 툭툭 끊김이 생기기 쉽다
-		// 댐핑은 속도가 높을수록 더 많이 감쇠되어 자연스러운 종단속도(terminal speed)를 만든다.
-		if (MovementMode == ESkullyMovementMode::Grounded && bIsSlopeSliding == true)
+		// 고정 스텝을 끄면 남은 누적 시간과 보간 오프셋을 정리
+		if (TimeAccumulator > 0.0f || InterpolationOffset.IsZero() == false)
 		{
-			const float Factor = FMath::Clamp(1.0f - SlideDamping * DeltaTime, 0.0f, 1.0f);
-			HorizontalVelocity *= Factor;
+			TimeAccumulator = 0.0f;
+			UnappliedInput = FVector::ZeroVector;
+			ApplyVisualOffset(FVector::ZeroVector);
 		}
-		else
-		{
-			// Friction은 초당 감속량처럼 동작
-			const FVector Decel = -HorizontalVelocity.GetSafeNormal() * Friction * DeltaTime;
+		
+		SimulateStep(DeltaTime);
+	}
+	
+	// 이동 상태값(현재 속력, 방향 등) 갱신
+	UpdateMotionState();
+	
+	// 정지 상태가 유지되면 잠듦
+	UpdateSleepState(DeltaTime);
+}
 
-			if (Decel.SizeSquared() >= HorizontalVelocity.SizeSquared())
-			{
-				HorizontalVelocity = FVector::ZeroVector;
-			}
-			else
-			{
-				HorizontalVelocity += Decel;
-			}
+void USkullyMovementComponent::SetInterpolatedVisualComponents(const TArray<USceneComponent*>& Components)
+{
+	// 기존 비주얼은 원래 상대 트랜스폼으로 되돌린 뒤 교체
+	for (const FSkullyInterpolatedVisual& Visual : InterpolatedVisuals)
+	{
+		if (USceneComponent* Component = Visual.Component.Get())
+		{
+			Component->SetRelativeLocationAndRotation(Visual.BaseRelativeLocation, Visual.BaseRelativeRotation);
+		}
+	}
+	InterpolatedVisuals.Reset();
+	VisualOffset = FVector::ZeroVector;
+	AppliedRollRotation = FQuat::Identity;
+	
+	for (USceneComponent* Component : Components)
+	{
+		if (Component != nullptr && Component != UpdatedComponent)
+		{
+			FSkullyInterpolatedVisual& Visual = InterpolatedVisuals.AddDefaulted_GetRef();
+			Visual.Component = Component;
+			Visual.BaseRelativeLocation = Component->GetRelativeLocation();
+			Visual.BaseRelativeRotation = Component->GetRelativeRotation().Quaternion();
+			Visual.LocalPivot = Component->GetRelativeTransform().InverseTransformPosition(FVector::ZeroVector);
 		}
+	}
+	
+	FlushVisualTransforms();
+}
 
-		// 마찰은 XY에만 적용
-		Velocity.X = HorizontalVelocity.X;
-		Velocity.Y = HorizontalVelocity.Y;
+// 한 스텝의 물리 처리: 중력 -> 경사 미끄러짐 -> 마찰 -> 이동 -> 지면 판정
+void USkullyMovementComponent::SimulateStep(float DeltaTime)
+{
+	INC_DWORD_STAT(STAT_SkullySimulationSteps);
+	
+	// 바닥 쿼리 캐시의 스텝 구분(Static이 아닌 히트는 이번 스텝 안에서만 재사용)
+	++GroundQueryCache.StepId;
+	
+	// 이번 스텝에 사용할 이동 모델 파라미터(스텝 도중 튜닝 값이 바뀌어도 한 스텝 안에서는 같은 값을 사용)
+	StepModelParams = MakeModelParams();
+	// 바닥 물리 머티리얼별 반응(직전 스텝 CheckGround의 바닥 기준)
+	if (const FSkullySurfaceResponse* SurfaceResponse = FindSurfaceResponse())
+	{
+		SurfaceResponse->ApplyTo(StepModelParams);
+	}
+	
+	const ESkullyMovementMode PrevMode = MovementMode;
+	const bool bWasSlopeSliding = bIsSlopeSliding;
+	
+	// 움직이는 바닥 따라가기(바닥 기준으로는 제자리)
+	ApplyMovementBaseDelta(DeltaTime);
+	// 중력 적용(Falling일 때만 Z 하강(아래로 가속))
+	ApplyGravity(DeltaTime);
+	// 경사면에서 정지 시 미끄러짐(굴러떨어짐) 적용
+	bSlopeSlideAppliedThisFrame = ApplySlopeSlide(DeltaTime);
+	// 마찰 적용(XY 감속(XY 속도를 줄여 미끄러짐/관성을 제어))
+	ApplyFriction(DeltaTime, bSlopeSlideAppliedThisFrame ? StepModelParams.SlidingFriction : StepModelParams.GroundFriction);
+	// 이동 처리(Sweep 기반 이동 + 충돌 처리(입력 기반 + 경사 투영 + 불안정 바닥 처리))
+	Move(DeltaTime);
+	// 지면 판정(Sweep + LineTrace로 Grounded/Falling 갱신)
+	// Move()가 먼저 움직인 뒤, CheckGround()가 새 위치에서 바닥 상태를 확정
+	CheckGround(DeltaTime);
+	// 다음 스텝에 따라갈 움직이는 바닥 갱신
+	UpdateMovementBase();
+	
+	// 상태 전환(착지/낙하, 슬라이드 시작/종료)을 Insights 채널에 기록
+	if (PrevMode != MovementMode)
+	{
+		SkullyTraceMovementEvent(this, MovementMode == ESkullyMovementMode::Grounded ? ESkullyMovementTraceEvent::Landed : ESkullyMovementTraceEvent::StartedFalling,
+			UpdatedComponent->GetComponentLocation(), Velocity.Size());
+	}
+	if (bWasSlopeSliding != bIsSlopeSliding)
+	{
+		SkullyTraceMovementEvent(this, bIsSlopeSliding ? ESkullyMovementTraceEvent::SlideStarted : ESkullyMovementTraceEvent::SlideStopped,
+			UpdatedComponent->GetComponentLocation(), Velocity.Size());
 	}
 }
 
-// 이동 처리
-void USkullyMovementComponent::Move(float DeltaTime)
+// 고정 시간 간격 적분: 프레임 시간을 누적해서 FixedTimestep 단위로 SimulateStep을 반복
+// 히치 프레임에서도 한 번의 Sweep 이동량이 FixedTimestep 분량으로 제한되어 얇은 경사 관통/슬라이드 폭주를 막는다
+void USkullyMovementComponent::TickFixedTimestep(float DeltaTime)
 {
-	// 누적 입력 벡터를 소비
-	const FVector Input = ConsumeMovementInput();
-	// 입력 벡터가 0에 가깝지 않다면 true
-	const bool bHasInput = !Input.IsNearlyZero();
-	// 입력 벡터의 방향
-	const FVector InputDir = bHasInput ? Input.GetSafeNormal() : FVector::ZeroVector;
+	const float Step = FMath::Max(FixedTimestep, KINDA_SMALL_NUMBER);
+	const int32 MaxSteps = FMath::Max(MaxSubstepsPerFrame, 1);
 	
-	// 목표 힘
-	FVector TargetVelocity2D = FVector::ZeroVector;
-	if (bHasInput == true)
+	// 최대 서브스텝으로 처리할 수 없는 시간은 버린다(물리 비용 상한 보장, 느린 프레임에서는 시뮬레이션이 약간 느려짐)
+	TimeAccumulator = FMath::Min(TimeAccumulator + DeltaTime, Step * MaxSteps);
+	
+	// 직전 프레임들이 서브스텝 없이 끝났으면 그때 들어온 입력을 이번 서브스텝에 적용(고주사율에서 짧은 입력이 사라지지 않도록)
+	if (FrameInput.IsNearlyZero() == true && UnappliedInput.IsNearlyZero() == false)
 	{
-		TargetVelocity2D = FVector(InputDir.X, InputDir.Y, 0.0f) * MaxSpeed;
+		FrameInput = UnappliedInput;
 	}
 	
-	// 현재 힘
-	FVector CurrentVelocity2D(Velocity.X, Velocity.Y, 0.0f);
-	if (TargetVelocity2D.IsNearlyZero() == false)
+	int32 NumSteps = 0;
+	while (TimeAccumulator >= Step && NumSteps < MaxSteps)
 	{
-		// 가속
-		CurrentVelocity2D = FMath::VInterpConstantTo(CurrentVelocity2D, TargetVelocity2D, DeltaTime, Acceleration);
+		// 보간 기준점: 마지막 서브스텝 직전 위치
+		PreviousStepLocation = UpdatedComponent->GetComponentLocation();
+		SimulateStep(Step);
+		TimeAccumulator -= Step;
+		++NumSteps;
 	}
+	UnappliedInput = NumSteps == 0 ? FrameInput : FVector::ZeroVector;
 	
-	CurrentVelocity2D = CurrentVelocity2D.GetClampedToMaxSize(MaxSpeed);
-	Velocity.X = CurrentVelocity2D.X;
-	Velocity.Y = CurrentVelocity2D.Y;
+	const FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
+	// 순간이동(텔레포트 등)으로 보간 거리가 비정상적으로 크면 보간하지 않음
+	if (FVector::DistSquared(PreviousStepLocation, CurrentLocation) > FMath::Square(MaxVisualInterpolationDistance))
+	{
+		PreviousStepLocation = CurrentLocation;
+	}
+	
+	// 렌더 보간: 남은 누적 시간 비율만큼 이전 스텝 위치와 현재 스텝 위치 사이에 메시를 표시
+	// 물리 위치는 항상 (이전 스텝 -> 현재 스텝) 구간의 끝이므로, 메시는 (1 - Alpha)만큼 뒤쪽에 그려진다
+	const float Alpha = FMath::Clamp(TimeAccumulator / Step, 0.0f, 1.0f);
+	ApplyVisualOffset((PreviousStepLocation - CurrentLocation) * (1.0f - Alpha));
+}
 
-	// 이번 프레임 이동량 계산
-	FVector MoveDelta = Velocity * DeltaTime;
+// 등록된 비주얼 컴포넌트(메시)에 월드 기준 보간 오프셋 적용(네트워크 보정 스무딩 오프셋을 더해서 적용)
+// 프레임 처리 중(고정 스텝 보간 + 네트워크 스무딩이 한 프레임에 여러 번 호출)에는 값만 저장하고 프레임 끝에서 한 번 적용
+void USkullyMovementComponent::ApplyVisualOffset(const FVector& WorldOffset)
+{
+	InterpolationOffset = WorldOffset;
+	
+	if (bDeferVisualUpdate == false)
+	{
+		FlushVisualTransforms();
+	}
+}
 
-	// Grounded일 때 경게/경사 이동 보정
-	// 경계/꼭지점에서 PlaneProject가 이동 벡터를 0으로 만들 수 있으므로, 이때는 투영 대신 입력 기반 이동으로 탈출
-	if (MovementMode == ESkullyMovementMode::Grounded)
+// 구르기 회전 누적: 미끄러짐 없이 구른다고 보고 이동 거리 / 반지름만큼 (위 x 진행 방향) 축으로 회전
+void USkullyMovementComponent::UpdateRollingVisual(float DeltaTime)
+{
+	if (RollingVisualMode == ESkullyRollingVisualMode::None)
 	{
-		// 현재 X/Y축 힘
-		const FVector Velocity2D(Velocity.X, Velocity.Y, 0.0f);
-		// 현재 힘의 크기
-		const float Speed2D = Velocity2D.Size();
-		// 현재 힘의 방향
-		const FVector VelocityDir2D = (Speed2D > KINDA_SMALL_NUMBER) ? (Velocity2D / Speed2D) : FVector::ZeroVector;
-		
-		// 현재 바닥의 노멀과 이전 프레임 바닥의 노멀의 내적: 현재 바닥 노멀과 이전 프레임 바닥 노멀의 변화량
-		const float NormalDot = FVector::DotProduct(CachedFloorNormal, LastFloorNormal);
-		// 안정적인 바닥인지 체크: 바닥 노멀을 믿기 어려운 상황(경계/꼭짓점/급격한 노멀 변동)을 감지하는 플래그
-		// 조건1: 바닥이 충분히 평평하지 않거나(경사), 노멀 자체가 수직인 특이 케이스
-		// 조건2: 노멀 변화량이 급격히 달라진 경우(면-면 경계/엣지)
-		const bool bUnstableFloor = CachedFloorNormal.Z < UnstableFloorZThreshold || 
-			NormalDot < FloorNormalDotEdgeThreshold;
-		// 보정 이동
-		FVector AdjustedMove;
-		// 슬라이드로 이미 자연스러운 속도가 만들어진 프레임에는
-		// 투영 붕괴(엣지/경계)에서의 최소 이동 보장(MinProjectedMoveCm)이 에너지를 인위적으로 주입할 수 있다.
-		// 입력이 있는 경우엔 조작감/정지 방지가 중요하니 최소 이동 보장을 허용
-		// 입력이 없고(정지 후 굴러떨어짐) 슬라이드가 적용된 프레임에는 최소 이동 보장을 끈다
-		const bool bAllowMinMoveGuarantee = bHasInput;
-		
-		// 불안정 바닥이면
-		if (bUnstableFloor == true)
+		RollRotation = FQuat::Identity;
+	}
+	else if (CurrentSpeed2D > KINDA_SMALL_NUMBER && DeltaTime > 0.0f)
+	{
+		const USphereComponent* Sphere = Cast<USphereComponent>(UpdatedComponent);
+		const float Radius = RollingVisualRadius > 0.0f ? RollingVisualRadius : (Sphere != nullptr ? Sphere->GetScaledSphereRadius() : 0.0f);
+		const FVector Axis = FVector::CrossProduct(FVector::UpVector, CurrentMoveDir2D).GetSafeNormal();
+		if (Radius > KINDA_SMALL_NUMBER && Axis.IsZero() == false)
 		{
-			const FVector FallbackDir = (bHasInput ? InputDir : VelocityDir2D);
-			if (FallbackDir.IsNearlyZero() == false)
-			{
-				const float CurrentSpeed = CurrentVelocity2D.Size();
-				// 입력 기반으로 강제 이동
-				AdjustedMove = FVector(FallbackDir.X * CurrentSpeed * DeltaTime, FallbackDir.Y * CurrentSpeed * DeltaTime, 0.0f);
-			}
-			else
-			{
-				// 방향이 없으면 최소한 투영 이동을 시도(완전 정지 + 애매한 히트 프레임)
-				AdjustedMove = FVector::VectorPlaneProject(MoveDelta, CachedFloorNormal);				
-			}
+			RollRotation = (FQuat(Axis, CurrentSpeed2D * DeltaTime / Radius) * RollRotation).GetNormalized();
 		}
-		// 안정 바닥이면
-		else
-		{
-			// 바닥 평면으로 투영
-			AdjustedMove = FVector::VectorPlaneProject(MoveDelta, CachedFloorNormal);
+	}
+	
+	FlushVisualTransforms();
+}
 
-			// 투영 결과가 너무 작으면
-			if (AdjustedMove.SizeSquared() < FMath::Square(MinProjectedMoveCm))
+// 보간 오프셋과 구르기 회전을 비주얼에 적용
+// Transform 모드: 바뀐 비주얼마다 SetRelativeLocationAndRotation 한 번(오프셋/회전을 따로 갱신하면 두 번)
+// CustomPrimitiveData 모드: 회전은 머티리얼 WPO에 맡기고 오프셋이 바뀔 때만 SetRelativeLocation
+void USkullyMovementComponent::FlushVisualTransforms()
+{
+	if (UpdatedComponent == nullptr || InterpolatedVisuals.Num() == 0)
+	{
+		return;
+	}
+	
+	const FVector TotalOffset = InterpolationOffset + NetSmoothingOffset;
+	const bool bOffsetChanged = VisualOffset.Equals(TotalOffset, 0.01f) == false;
+	const float RollDelta = FMath::RadiansToDegrees(AppliedRollRotation.AngularDistance(RollRotation));
+	const bool bRollChanged = RollDelta > KINDA_SMALL_NUMBER;
+	// 최소 회전 변화 이하는 미룸(회전만 바뀌었을 때), 정지 직후에는 남은 회전까지 맞춤
+	const bool bApplyRoll = bRollChanged == true && (RollDelta >= MinRollUpdateDegrees || bOffsetChanged == true || CurrentSpeed2D <= KINDA_SMALL_NUMBER);
+	
+	if (bOffsetChanged == false && bApplyRoll == false)
+	{
+		return;
+	}
+	
+	// 비교 기준: 오프셋과 회전을 바뀔 때마다 따로 갱신하는 방식
+	const int32 NumVisuals = InterpolatedVisuals.Num();
+	const int32 NaiveUpdates = NumVisuals * ((bOffsetChanged ? 1 : 0) + (bRollChanged ? 1 : 0));
+	int32 Updates = 0;
+	
+	VisualOffset = TotalOffset;
+	if (bApplyRoll == true)
+	{
+		AppliedRollRotation = RollRotation;
+	}
+	
+	const FQuat RootRotation = UpdatedComponent->GetComponentQuat();
+	const FVector LocalOffset = UpdatedComponent->GetComponentTransform().InverseTransformVectorNoScale(VisualOffset);
+	// 월드 기준 구르기 회전을 루트 컴포넌트 로컬 공간으로 변환
+	const FQuat LocalRoll = RootRotation.Inverse() * AppliedRollRotation * RootRotation;
+	
+	for (const FSkullyInterpolatedVisual& Visual : InterpolatedVisuals)
+	{
+		USceneComponent* Component = Visual.Component.Get();
+		if (Component == nullptr)
+		{
+			continue;
+		}
+		
+		if (RollingVisualMode == ESkullyRollingVisualMode::CustomPrimitiveData)
+		{
+			if (bApplyRoll == true)
 			{
-				const FVector FallbackDir = (bHasInput ? InputDir : VelocityDir2D);
-				const float CurrentSpeed = CurrentVelocity2D.Size();
-				// 투영이 붕괴하면(엣지/경계) fallback을 사용하되, MaxSpeed로 덮지 않고 현재 속도를 사용
-				AdjustedMove = FVector(FallbackDir.X * CurrentSpeed * DeltaTime, FallbackDir.Y * CurrentSpeed * DeltaTime, 0.0f);
-			
-				// 완전 처음 가속 초반에 CurrentSpeed가 너무 작으면 최소 이동 보장
-				// (단, 입력이 없는 슬라이드 프레임에는 에너지 주입/워프를 막기 위해 적용하지 않는다)
-				if (bAllowMinMoveGuarantee == true && AdjustedMove.SizeSquared() < FMath::Square(MinProjectedMoveCm))
+				if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
 				{
-					AdjustedMove = FVector(FallbackDir.X, FallbackDir.Y, 0.0f) * MinProjectedMoveCm;
+					// 비주얼 컴포넌트 로컬 공간 회전과 회전 기준점(구 중심)
+					const FQuat MeshRoll = Visual.BaseRelativeRotation.Inverse() * LocalRoll * Visual.BaseRelativeRotation;
+					Primitive->SetCustomPrimitiveDataVector4(RollCustomDataIndex, FVector4(MeshRoll.X, MeshRoll.Y, MeshRoll.Z, MeshRoll.W));
+					Primitive->SetCustomPrimitiveDataVector3(RollCustomDataIndex + 4, Visual.LocalPivot);
+				}
+			}
+			if (bOffsetChanged == true)
+			{
+				Component->SetRelativeLocation(Visual.BaseRelativeLocation + LocalOffset);
+				++Updates;
+			}
+			continue;
+		}
+		
+		// 구 중심(루트 원점) 기준으로 상대 위치와 회전을 함께 돌림
+		Component->SetRelativeLocationAndRotation(LocalRoll.RotateVector(Visual.BaseRelativeLocation) + LocalOffset, LocalRoll * Visual.BaseRelativeRotation);
+		++Updates;
+	}
+	
+	INC_DWORD_STAT_BY(STAT_SkullyVisualTransformUpdates, Updates);
+	INC_DWORD_STAT_BY(STAT_SkullyVisualTransformUpdatesSaved, FMath::Max(NaiveUpdates - Updates, 0));
+}
+
+// 이동 모델 파라미터: 컴포넌트의 튜닝 값을 모델 계산 함수에 넘기기 위한 사본
+FSkullyMovementModelParams USkullyMovementComponent::MakeModelParams() const
+{
+	FSkullyMovementModelParams Params;
+	Params.Gravity = Gravity;
+	Params.MaxSpeed = MaxSpeed;
+	Params.Acceleration = Acceleration;
+	Params.GroundFriction = GroundFriction;
+	Params.AirFriction = AirFriction;
+	Params.SlidingFriction = SlidingFriction;
+	Params.MinSlopeSlideStartSpeed = MinSlopeSlideStartSpeed;
+	Params.MaxSlopeSlideSpeed = MaxSlopeSlideSpeed;
+	Params.SlopeSlideScale = SlopeSlideScale;
+	Params.StaticFrictionAccel = StaticFrictionAccel;
+	Params.SlideDamping = SlideDamping;
+	Params.UnstableFloorZThreshold = UnstableFloorZThreshold;
+	Params.FloorNormalDotEdgeThreshold = FloorNormalDotEdgeThreshold;
+	Params.WalkableFloorZ = GetWalkableFloorZ();
+	Params.GroundCheckDistance = GroundCheckDistance;
+	Params.MaxGroundDistance = MaxGroundDistance;
+	Params.GroundGraceZOffset = GroundGraceZOffset;
+	Params.FlatGroundZThreshold = FlatGroundZThreshold;
+	Params.FloorNormalInterpSpeed = FloorNormalInterpSpeed;
+	
+	return Params;
+}
+
+// 움직이는 바닥 따라가기: 바닥 기준 상대 위치를 유지하도록 바닥의 이동/회전만큼 먼저 옮김
+void USkullyMovementComponent::ApplyMovementBaseDelta(float DeltaTime)
+{
+	bBaseMovedThisStep = false;
+	
+	UPrimitiveComponent* Base = MovementBase.Get();
+	if (bTrackMovingBase == false || Base == nullptr)
+	{
+		return;
+	}
+	
+	BaseElapsedTime += DeltaTime;
+	
+	const FTransform BaseTransform = Base->GetComponentTransform();
+	if (BaseTransform.Equals(LastBaseTransform, 1.e-4f) == true)
+	{
+		// 같은 프레임의 나머지 서브스텝에서는 바닥이 움직이지 않으므로 속도 유지, 움직임 없이 새 프레임이 왔으면 멈춘 바닥
+		if (GFrameCounter != LastBaseMoveFrame)
+		{
+			MovementBaseVelocity = FVector::ZeroVector;
+		}
+		return;
+	}
+	
+	// 프레임의 바닥 이동은 첫 서브스텝에 한꺼번에 들어오므로, 직전 바닥 이동 이후 흐른 시간(약 한 프레임)으로 나눔
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+	const FVector BaseDelta = BaseTransform.TransformPosition(LastBaseTransform.InverseTransformPosition(Location)) - Location;
+	LastBaseTransform = BaseTransform;
+	MovementBaseVelocity = BaseElapsedTime > KINDA_SMALL_NUMBER ? BaseDelta / BaseElapsedTime : FVector::ZeroVector;
+	BaseElapsedTime = 0.0f;
+	LastBaseMoveFrame = GFrameCounter;
+	bBaseMovedThisStep = true;
+	
+	// 바닥은 이미 움직여서 겹쳐 있을 수 있으므로 바닥만 무시하고 스윕(다른 물체에는 막힘)
+	if (UpdatedPrimitive != nullptr)
+	{
+		UpdatedPrimitive->IgnoreComponentWhenMoving(Base, true);
+	}
+	
+	INC_DWORD_STAT(STAT_SkullyMoveSweeps);
+	++QueryCounters.MoveSweeps;
+	MoveUpdatedComponent(BaseDelta, UpdatedComponent->GetComponentQuat(), true);
+	
+	if (UpdatedPrimitive != nullptr)
+	{
+		UpdatedPrimitive->IgnoreComponentWhenMoving(Base, false);
+	}
+}
+
+// 지면 판정 결과로 추적할 바닥 갱신: Grounded이고 바닥이 Movable일 때만 추적
+void USkullyMovementComponent::UpdateMovementBase()
+{
+	UPrimitiveComponent* Floor = MovementMode == ESkullyMovementMode::Grounded ? CurrentFloorHit.GetComponent() : nullptr;
+	if (bTrackMovingBase == false || Floor == nullptr || Floor->Mobility != EComponentMobility::Movable)
+	{
+		// 움직이는 바닥에서 떨어지면 바닥 속도를 이어받음
+		if (MovementBase.IsValid() == true && MovementMode == ESkullyMovementMode::Falling && bImpartBaseVelocityOnLeave == true)
+		{
+			Velocity += MovementBaseVelocity;
+		}
+		
+		if (AActor* OldBaseOwner = MovementBase.IsValid() ? MovementBase->GetOwner() : nullptr)
+		{
+			RemoveTickPrerequisiteActor(OldBaseOwner);
+		}
+		MovementBase.Reset();
+		MovementBaseVelocity = FVector::ZeroVector;
+		return;
+	}
+	
+	if (Floor != MovementBase.Get())
+	{
+		if (AActor* OldBaseOwner = MovementBase.IsValid() ? MovementBase->GetOwner() : nullptr)
+		{
+			RemoveTickPrerequisiteActor(OldBaseOwner);
+		}
+		
+		// 바닥이 먼저 움직인 뒤 따라가도록 틱 순서 지정
+		if (AActor* BaseOwner = Floor->GetOwner())
+		{
+			AddTickPrerequisiteActor(BaseOwner);
+		}
+		
+		MovementBase = Floor;
+		LastBaseTransform = Floor->GetComponentTransform();
+		MovementBaseVelocity = FVector::ZeroVector;
+		BaseElapsedTime = 0.0f;
+		LastBaseMoveFrame = GFrameCounter;
+	}
+}
+
+void USkullyMovementComponent::SetSurfaceResponseTable(USkullySurfaceResponseTable* NewTable)
+{
+	SurfaceResponseTable = NewTable;
+	FlushSurfaceResponseCache();
+}
+
+void USkullyMovementComponent::FlushSurfaceResponseCache()
+{
+	SurfaceResponseCache.Reset();
+	SurfaceFloorKey = TObjectKey<UPrimitiveComponent>();
+	CurrentSurfaceResponse.Reset();
+	SurfaceResponseTableChangeCounter = SurfaceResponseTable != nullptr ? SurfaceResponseTable->GetChangeCounter() : 0;
+}
+
+// 현재 바닥의 반응: 같은 바닥 위에서는 조회 없음, 바닥이 바뀌면 프리미티브별 캐시(해시 1회), 처음 밟는 바닥만 테이블 조회
+const FSkullySurfaceResponse* USkullyMovementComponent::FindSurfaceResponse()
+{
+	if (SurfaceResponseTable == nullptr || MovementMode != ESkullyMovementMode::Grounded)
+	{
+		return nullptr;
+	}
+	
+	// 테이블이 바뀌었거나(에디터 수정 등) 밟은 바닥이 너무 많으면 캐시를 비우고 다시 조회
+	if (SurfaceResponseTableChangeCounter != SurfaceResponseTable->GetChangeCounter() || SurfaceResponseCache.Num() >= MaxSurfaceResponseCacheEntries)
+	{
+		FlushSurfaceResponseCache();
+	}
+	
+	UPrimitiveComponent* Floor = CurrentFloorHit.GetComponent();
+	const TObjectKey<UPrimitiveComponent> FloorKey(Floor);
+	if (FloorKey == SurfaceFloorKey)
+	{
+		return CurrentSurfaceResponse.GetPtrOrNull();
+	}
+	
+	SurfaceFloorKey = FloorKey;
+	if (const TOptional<FSkullySurfaceResponse>* CachedResponse = SurfaceResponseCache.Find(FloorKey))
+	{
+		CurrentSurfaceResponse = *CachedResponse;
+		return CurrentSurfaceResponse.GetPtrOrNull();
+	}
+	
+	// 바닥 쿼리는 물리 머티리얼을 반환하지 않으므로(쿼리 비용) 바디의 단순 충돌 머티리얼로 조회
+	const UPhysicalMaterial* PhysicalMaterial = CurrentFloorHit.PhysMaterial.Get();
+	if (PhysicalMaterial == nullptr && Floor != nullptr)
+	{
+		if (const FBodyInstance* BodyInstance = Floor->GetBodyInstance())
+		{
+			PhysicalMaterial = BodyInstance->GetSimplePhysicalMaterial();
+		}
+	}
+	
+	const FSkullySurfaceResponse* Response = SurfaceResponseTable->Find(PhysicalMaterial);
+	CurrentSurfaceResponse = Response != nullptr ? TOptional<FSkullySurfaceResponse>(*Response) : TOptional<FSkullySurfaceResponse>();
+	SurfaceResponseCache.Add(FloorKey, CurrentSurfaceResponse);
+	
+	return CurrentSurfaceResponse.GetPtrOrNull();
+}
+
+// 중력 적용
+void USkullyMovementComponent::ApplyGravity(float DeltaTime)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyApplyGravity, SkullyMovement_ApplyGravity);
+	
+	SkullyMovementModel::ApplyGravity(Velocity, MovementMode == ESkullyMovementMode::Grounded, StepModelParams, DeltaTime);
+}
+
+// 경사면 미끄러짐 적용: 플레이어가 가만히 있는데 경사가 있으면 굴러떨어지는 전용 로직
+bool USkullyMovementComponent::ApplySlopeSlide(float DeltaTime)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyApplySlopeSlide, SkullyMovement_ApplySlopeSlide);
+	
+	// 기본 전제: Grounded + 입력 없음일 때만 정지 후 굴러떨어짐을 평가한다.
+	if (MovementMode != ESkullyMovementMode::Grounded || FrameInput.IsNearlyZero() == false)
+	{
+		bIsSlopeSliding = false;
+		return false;
+	}
+	
+	FVector UseNormal;
+	FVector AlongPlane = SkullyMovementModel::ComputeSlopeGravity(CachedFloorNormal, LastFloorNormal, StepModelParams, UseNormal);
+	
+	// 상각형 경계, 플랫폼 끝, 경사-평지 전환 등으로 노멀이 애매해서 AlongPlane이 거의 0이면
+	if (AlongPlane.SizeSquared() < KINDA_SMALL_NUMBER)
+	{
+		FVector DownhillDir;
+		// 주변 바닥 높이를 샘플링해서 진짜 내리막 방향(downhill)을 추정
+		if (UseNormal.Z < MinSlopeForSamplesZ && GetDownhillDir(DownhillDir) == true)
+		{
+			AlongPlane = DownhillDir * Gravity;
+		}
+		else
+		{
+			bIsSlopeSliding = false;
+			return false;
+		}
+	}
+	
+	return SkullyMovementModel::ApplySlopeSlideAccel(Velocity, bIsSlopeSliding, AlongPlane, StepModelParams, DeltaTime);
+}
+
+// 마찰 적용
+void USkullyMovementComponent::ApplyFriction(float DeltaTime, float GroundedFriction)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyApplyFriction, SkullyMovement_ApplyFriction);
+	
+	SkullyMovementModel::ApplyFriction(Velocity, MovementMode == ESkullyMovementMode::Grounded, bIsSlopeSliding, GroundedFriction, StepModelParams, DeltaTime);
+}
+
+// 이동 처리
+void USkullyMovementComponent::Move(float DeltaTime)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyMove, SkullyMovement_Move);
+	
+	// 이번 프레임에 소비한 입력 벡터
+	const FVector Input = FrameInput;
+	// 입력 벡터가 0에 가깝지 않다면 true
+	const bool bHasInput = !Input.IsNearlyZero();
+	// 입력 벡터의 방향
+	const FVector InputDir = bHasInput ? Input.GetSafeNormal() : FVector::ZeroVector;
+	
+	// 입력 방향으로 가속 + 최대 속력 제한
+	SkullyMovementModel::ApplyInputAcceleration(Velocity, InputDir, bHasInput, StepModelParams, DeltaTime);
+	
+	// 현재 힘
+	const FVector CurrentVelocity2D(Velocity.X, Velocity.Y, 0.0f);
+
+	// 이번 프레임 이동량 계산
+	FVector MoveDelta = Velocity * DeltaTime;
+
+	// Grounded일 때 경게/경사 이동 보정
+	// 경계/꼭지점에서 PlaneProject가 이동 벡터를 0으로 만들 수 있으므로, 이때는 투영 대신 입력 기반 이동으로 탈출
+	if (MovementMode == ESkullyMovementMode::Grounded)
+	{
+		// 현재 X/Y축 힘
+		const FVector Velocity2D(Velocity.X, Velocity.Y, 0.0f);
+		// 현재 힘의 크기
+		const float Speed2D = Velocity2D.Size();
+		// 현재 힘의 방향
+		const FVector VelocityDir2D = (Speed2D > KINDA_SMALL_NUMBER) ? (Velocity2D / Speed2D) : FVector::ZeroVector;
+		
+		// 안정적인 바닥인지 체크: 바닥 노멀을 믿기 어려운 상황(경계/꼭짓점/급격한 노멀 변동)을 감지하는 플래그
+		const bool bUnstableFloor = SkullyMovementModel::IsUnstableFloor(CachedFloorNormal, LastFloorNormal, StepModelParams);
+		// 보정 이동
+		FVector AdjustedMove;
+		// 슬라이드로 이미 자연스러운 속도가 만들어진 프레임에는
+		// 투영 붕괴(엣지/경계)에서의 최소 이동 보장(MinProjectedMoveCm)이 에너지를 인위적으로 주입할 수 있다.
+		// 입력이 있는 경우엔 조작감/정지 방지가 중요하니 최소 이동 보장을 허용
+		// 입력이 없고(정지 후 굴러떨어짐) 슬라이드가 적용된 프레임에는 최소 이동 보장을 끈다
+		const bool bAllowMinMoveGuarantee = bHasInput;
+		
+		// 불안정 바닥이면
+		if (bUnstableFloor == true)
+		{
+			const FVector FallbackDir = (bHasInput ? InputDir : VelocityDir2D);
+			if (FallbackDir.IsNearlyZero() == false)
+			{
+				const float CurrentSpeed = CurrentVelocity2D.Size();
+				// 입력 기반으로 강제 이동
+				AdjustedMove = FVector(FallbackDir.X * CurrentSpeed * DeltaTime, FallbackDir.Y * CurrentSpeed * DeltaTime, 0.0f);
+			}
+			else
+			{
+				// 방향이 없으면 최소한 투영 이동을 시도(완전 정지 + 애매한 히트 프레임)
+				AdjustedMove = FVector::VectorPlaneProject(MoveDelta, CachedFloorNormal);				
+			}
+		}
+		// 안정 바닥이면
+		else
+		{
+			// 바닥 평면으로 투영
+			AdjustedMove = FVector::VectorPlaneProject(MoveDelta, CachedFloorNormal);
+
+			// 투영 결과가 너무 작으면
+			if (AdjustedMove.SizeSquared() < FMath::Square(MinProjectedMoveCm))
+			{
+				const FVector FallbackDir = (bHasInput ? InputDir : VelocityDir2D);
+				const float CurrentSpeed = CurrentVelocity2D.Size();
+				// 투영이 붕괴하면(엣지/경계) fallback을 사용하되, MaxSpeed로 덮지 않고 현재 속도를 사용
+				AdjustedMove = FVector(FallbackDir.X * CurrentSpeed * DeltaTime, FallbackDir.Y * CurrentSpeed * DeltaTime, 0.0f);
+			
+				// 완전 처음 가속 초반에 CurrentSpeed가 너무 작으면 최소 이동 보장
+				// (단, 입력이 없는 슬라이드 프레임에는 에너지 주입/워프를 막기 위해 적용하지 않는다)
+				if (bAllowMinMoveGuarantee == true && AdjustedMove.SizeSquared() < FMath::Square(MinProjectedMoveCm))
+				{
+					AdjustedMove = FVector(FallbackDir.X, FallbackDir.Y, 0.0f) * MinProjectedMoveCm;
 				}
 			}
 		}
@@ -299,14 +815,25 @@ void USkullyMovementComponent::Move(float DeltaTime)
 		MoveDelta = AdjustedMove;
 	}
 	
+	// 다중 반복 이동 해결(1이면 아래의 기존 단일 슬라이드 경로)
+	if (MaxMoveIterations > 1)
+	{
+		ResolveMove(MoveDelta);
+		return;
+	}
+	
 	// Sweep 이동(관통 방지) + Hit 결과를 돌려줌
 	FHitResult Hit;
+	INC_DWORD_STAT(STAT_SkullyMoveSweeps);
+	++QueryCounters.MoveSweeps;
 	SafeMoveUpdatedComponent(MoveDelta, UpdatedComponent->GetComponentQuat(), true, Hit);
 
 	// 막혔으면
 	if (Hit.bBlockingHit == true)
 	{
 		// 벽을 타고 미끄러짐 시도
+		INC_DWORD_STAT(STAT_SkullySlideAlongSurface);
+		++QueryCounters.MoveSweeps;
 		SlideAlongSurface(MoveDelta, 1.0f - Hit.Time, Hit.Normal, Hit);
 
 		// Grounded면 한 번 더 바닥 기준 재투영 이동을 짧게 시도
@@ -328,6 +855,9 @@ void USkullyMovementComponent::Move(float DeltaTime)
 			if (FloorSlide.IsNearlyZero() == false)
 			{
 				FHitResult FloorHit;
+				INC_DWORD_STAT(STAT_SkullyFloorReprojections);
+				INC_DWORD_STAT(STAT_SkullyMoveSweeps);
+				++QueryCounters.MoveSweeps;
 				// FloorSlide * 0.5f는 과도한 재시도로 튀는 것을 방지하기 위한 안전 스텝
 				SafeMoveUpdatedComponent(FloorSlide * 0.5f, UpdatedComponent->GetComponentQuat(), true, FloorHit);
 			}
@@ -335,6 +865,98 @@ void USkullyMovementComponent::Move(float DeltaTime)
 	}
 }
 
+// 다중 반복 이동: 막히면 남은 이동(시간 비율)을 표면을 따라 다시 스윕
+// 한 스텝 이동이 구 지름 여러 개에 걸치는 고속 슬라이드에서도 코너/경사 변화마다 이동량을 버리지 않는다.
+void USkullyMovementComponent::ResolveMove(const FVector& MoveDelta)
+{
+	const FQuat Rotation = UpdatedComponent->GetComponentQuat();
+	FVector Delta = MoveDelta;
+	// 이번 스텝에서 아직 쓰지 않은 시간 비율
+	float RemainingTime = 1.0f;
+	float DepenetrationUsed = 0.0f;
+	FVector PreviousNormal = FVector::ZeroVector;
+	int32 Iterations = 0;
+	
+	while (Iterations < MaxMoveIterations && RemainingTime > KINDA_SMALL_NUMBER && Delta.IsNearlyZero(1.e-3f) == false)
+	{
+		++Iterations;
+		INC_DWORD_STAT(STAT_SkullyMoveSweeps);
+		++QueryCounters.MoveSweeps;
+		
+		FHitResult Hit;
+		MoveUpdatedComponent(Delta, Rotation, true, &Hit);
+		
+		// 시작부터 겹쳐 있으면 예산 안에서 밀어낸 뒤 같은 이동을 다시 시도
+		if (Hit.bStartPenetrating == true)
+		{
+			const FVector Adjustment = GetPenetrationAdjustment(Hit);
+			const float AdjustmentSize = Adjustment.Size();
+			if (DepenetrationUsed + AdjustmentSize > MaxDepenetrationPerMove || ResolvePenetration(Adjustment, Hit, Rotation) == false)
+			{
+				break;
+			}
+			
+			DepenetrationUsed += AdjustmentSize;
+			INC_DWORD_STAT(STAT_SkullyMoveDepenetrations);
+			continue;
+		}
+		
+		if (Hit.bBlockingHit == false)
+		{
+			RemainingTime = 0.0f;
+			break;
+		}
+		
+		RemainingTime *= 1.0f - Hit.Time;
+		const FVector Remaining = Delta * (1.0f - Hit.Time);
+		const bool bWalkableHit = Hit.Normal.Z >= StepModelParams.WalkableFloorZ;
+		
+		FVector NewDelta;
+		if (MovementMode == ESkullyMovementMode::Grounded && bWalkableHit == true)
+		{
+			// 걸을 수 있는 면(오르막 경사 변화): 방향만 새 면을 따라 꺾고 남은 이동 길이는 유지
+			NewDelta = FVector::VectorPlaneProject(Remaining, Hit.Normal).GetSafeNormal() * Remaining.Size();
+		}
+		else
+		{
+			NewDelta = ComputeSlideVector(Remaining, 1.0f, Hit.Normal, Hit);
+			
+			// 두 면 사이(코너)에 끼면 두 면의 교선 방향으로
+			if (PreviousNormal.IsZero() == false)
+			{
+				TwoWallAdjust(NewDelta, Hit, PreviousNormal);
+			}
+			
+			// Grounded에서 벽에 막히면 바닥 평면으로 재투영해 바닥을 따라 계속 진행(기존 2-pass 재투영 대체)
+			// 경사 슬라이드가 적용된 프레임에는 이동 폭발을 막기 위해 재투영하지 않음
+			if (MovementMode == ESkullyMovementMode::Grounded && bSlopeSlideAppliedThisFrame == false)
+			{
+				const FVector FloorSlide = FVector::VectorPlaneProject(NewDelta, CachedFloorNormal);
+				if (FloorSlide.IsNearlyZero() == false)
+				{
+					INC_DWORD_STAT(STAT_SkullyFloorReprojections);
+					NewDelta = FloorSlide;
+				}
+			}
+		}
+		
+		// 처음 이동 방향과 반대로 꺾이면 진동하므로 중단
+		if ((NewDelta | MoveDelta) <= 0.0f)
+		{
+			break;
+		}
+		
+		PreviousNormal = Hit.Normal;
+		Delta = NewDelta;
+	}
+	
+	INC_DWORD_STAT_BY(STAT_SkullyMoveIterations, Iterations);
+	if (Iterations >= MaxMoveIterations && RemainingTime > KINDA_SMALL_NUMBER)
+	{
+		INC_DWORD_STAT(STAT_SkullyMoveIterationLimitHits);
+	}
+}
+
 // PawnMovementComponent의 입력 누적 벡터를 가져오고 초기화
 FVector USkullyMovementComponent::ConsumeMovementInput()
 {
@@ -353,13 +975,15 @@ FVector USkullyMovementComponent::ConsumeMovementInput()
 // 지면 판정: 바닥 상태를 판정(+ 경사각 조건 + 흔들림 방지(깜빡임 방지) + 보조 바닥 확인)
 void USkullyMovementComponent::CheckGround(float DeltaTime)
 {
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullyCheckGround, SkullyMovement_CheckGround);
+	
 	const ESkullyMovementMode PrevMode = MovementMode;
 	
 	// 바닥 감지
 	FHitResult Hit;
 	const bool bHitGround = SweepGround(Hit);
 	// 허용 경사각
-	const float WalkableZ = FMath::Cos(FMath::DegreesToRadians(MaxSlopeAngle));
+	const float WalkableZ = GetWalkableFloorZ();
 	// Walkable 판정이 살짝 흔들려도(노멀 튐) Grounded 상태를 유지하는 관용값
 	// 없으면 경계면/경계/꼭짓점에서 노멀 값이 할 프레임씩 튀면서 Grounded <-> Falling이 깜빡거림(Ground jitter)
 	// 그 결과 이동이 끊기고 미세한 떨림, 툭툭 끊기는 느낌이 남
@@ -432,17 +1056,7 @@ void USkullyMovementComponent::CheckGround(float DeltaTime)
 	// 특히 엣지/꼭짓점에서 Sweep 결과가 불안정할 때 붙잡아주는 역할
 	{
 		FHitResult LineHit;
-		const FVector StartPos = UpdatedComponent->GetComponentLocation();
-		const FVector EndPos = StartPos - FVector::UpVector * GroundLineTraceDistance;
-
-		FCollisionQueryParams Params(SCENE_QUERY_STAT(SkullyGroundSweep), false);
-		Params.AddIgnoredActor(GetOwner());
-		// FaceIndex를 받게 설정
-		Params.bReturnFaceIndex = true;
-		// 삼각형 기반(Complex)으로 받게 설정
-		Params.bTraceComplex = true;
-		
-		if (GetWorld()->LineTraceSingleByChannel(LineHit, StartPos, EndPos, ECC_Visibility, Params))
+		if (LineTraceGround(LineHit) == true)
 		{
 			if (LineHit.ImpactNormal.Z >= WalkableZ)
 			{
@@ -466,6 +1080,31 @@ void USkullyMovementComponent::UpdateMotionState()
 	CurrentSpeed2D = Velocity2D.Size();
 	
 	CurrentMoveDir2D = (CurrentSpeed2D > KINDA_SMALL_NUMBER) ? Velocity2D / CurrentSpeed2D : FVector::ZeroVector;
+	
+	UpdateGimmickCell();
+}
+
+void USkullyMovementComponent::UpdateGimmickCell()
+{
+	// 보정 재시뮬레이션 중에는 이미 알린 칸을 다시 지나가므로 알리지 않음(끝난 뒤 최종 위치로 한 번 알림)
+	if (UpdatedComponent == nullptr || bIsReplayingMoves == true)
+	{
+		return;
+	}
+	
+	// 칸이 바뀔 때만 알림(칸 안에서의 진입/이탈 판정은 서브시스템이 기믹이 있는 칸에서만 수행)
+	const FIntPoint Cell = USkullyGimmickSubsystem::GetCellCoord(UpdatedComponent->GetComponentLocation());
+	if (bHasGimmickCell == true && Cell == GimmickCell)
+	{
+		return;
+	}
+	
+	if (USkullyGimmickSubsystem* Gimmicks = GetWorld()->GetSubsystem<USkullyGimmickSubsystem>())
+	{
+		Gimmicks->NotifyBodyCellChanged(this, Cell);
+		GimmickCell = Cell;
+		bHasGimmickCell = true;
+	}
 }
 
 // 바닥 감지: 현재 구의 위치에서 아래로 Sphere Sweep하여 정보를 반환
@@ -481,89 +1120,751 @@ bool USkullyMovementComponent::SweepGround(FHitResult& OutHit)
 	const float Radius = Sphere->GetScaledSphereRadius();
 	// 스윕 시작 지점은 구의 중심
 	const FVector StartPos = UpdatedComponent->GetComponentLocation();
-	// 스윕 감지 지점은 구의 반지름 + GroundCheckDistance만큼의 아래 방향 지점
-	const FVector EndPos = StartPos - FVector::UpVector * (Radius + GroundCheckDistance);
-
-	// 자기 자신은 무시
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(SkullyGroundSweep), false);
-	Params.AddIgnoredActor(GetOwner());
-	// FaceIndex를 받게 설정
-	Params.bReturnFaceIndex = true;
-	// FaceIndex를 삼각형 기반(Complex)으로 받게 설정
-	Params.bTraceComplex = true;
-
-	// StartPos 지점에서 EndPos 지점까지 Radius 반지름만큼의 구를 Sweep하여 출력 매개 변수인 OutHit에 정보를 반환 
-	return GetWorld()->SweepSingleByChannel(OutHit, StartPos, EndPos, FQuat::Identity, ECC_Visibility,
-	                                        FCollisionShape::MakeSphere(Radius), Params);
-}
+	
+	// 같은 위치/반지름에서 이미 스윕한 결과가 있으면 재사용
+	if (bUseGroundQueryCache == true && GroundQueryCache.SweepKey.Matches(StartPos, Radius, GroundQueryCache.StepId, GroundQueryCacheTolerance) == true)
+	{
+		OutHit = GroundQueryCache.SweepHit;
+		return GroundQueryCache.bSweepHit;
+	}
+	
+	// 움직이는 바닥 위에서 바닥 기준으로 제자리면 바닥과 함께 옮긴 결과를 재사용
+	if (bUseGroundQueryCache == true && TryReuseBaseRelativeSweep(StartPos, Radius, OutHit) == true)
+	{
+		return true;
+	}
+	
+	// 구워진 바닥 격자에서 확실한 바닥이면 스윕 생략(움직이는 바닥 위에서는 항상 씬 쿼리)
+	if (bUseWalkabilityField == true && MovementBase.IsValid() == false)
+	{
+		USkullyWalkabilitySubsystem* Walkability = GetWorld()->GetSubsystem<USkullyWalkabilitySubsystem>();
+		if (Walkability != nullptr && Walkability->SweepGround(StartPos, Radius, Radius + GroundCheckDistance, MaxGroundDistance, GetWalkableFloorZ(), OutHit) == true)
+		{
+			GroundQueryCache.SweepKey.Set(StartPos, Radius, GroundQueryCache.StepId, true);
+			GroundQueryCache.SweepHit = OutHit;
+			GroundQueryCache.bSweepHit = true;
+			GroundQueryCache.SweepBase.Reset();
+			return true;
+		}
+	}
+	
+	// 스윕 감지 지점은 구의 반지름 + GroundCheckDistance만큼의 아래 방향 지점
+	const FVector EndPos = StartPos - FVector::UpVector * (Radius + GroundCheckDistance);
+	const FCollisionShape Shape = FCollisionShape::MakeSphere(Radius);
 
-// 구체 캐릭터가 바닥에 정확히 닿도록 위치를 보정
-// 착지 순간 지면에 파고들거나 떠 있는 오차를 제거하기 위한 스냅
-void USkullyMovementComponent::SnapToGround(const FHitResult& Hit)
+	// 단순 충돌(Simple)로 먼저 감지하고, 판정이 애매할 때만 삼각형 기반(Complex)으로 다시 감지
+	const bool bComplexOnly = GroundProbeFidelity == ESkullyGroundProbeFidelity::Complex;
+	bool bHit = SweepGroundQuery(OutHit, StartPos, EndPos, Shape, bComplexOnly);
+	
+	if (GroundProbeFidelity == ESkullyGroundProbeFidelity::Adaptive && IsAmbiguousGroundHit(bHit, OutHit) == true)
+	{
+		INC_DWORD_STAT(STAT_SkullyGroundProbeComplexFallback);
+		bHit = SweepGroundQuery(OutHit, StartPos, EndPos, Shape, true);
+	}
+	
+	GroundQueryCache.SweepKey.Set(StartPos, Radius, GroundQueryCache.StepId, bHit == true && IsStaticHit(OutHit));
+	GroundQueryCache.SweepHit = OutHit;
+	GroundQueryCache.bSweepHit = bHit;
+	
+	const UPrimitiveComponent* Base = MovementBase.Get();
+	if (bHit == true && Base != nullptr && OutHit.GetComponent() == Base)
+	{
+		GroundQueryCache.SweepBase = Base;
+		GroundQueryCache.SweepBaseTransform = Base->GetComponentTransform();
+		GroundQueryCache.SweepBaseLocalStart = GroundQueryCache.SweepBaseTransform.InverseTransformPosition(StartPos);
+	}
+	else
+	{
+		GroundQueryCache.SweepBase.Reset();
+	}
+	
+	return bHit;
+}
+
+// 움직이는 바닥 위 스윕 재사용: 바닥이 강체로 움직였고 구도 바닥 기준으로 제자리면 히트도 같은 변환으로 옮기면 된다
+// 다른 물체가 그 사이에 끼어드는 경우는 Static 캐시와 마찬가지로 감지하지 못함
+bool USkullyMovementComponent::TryReuseBaseRelativeSweep(const FVector& StartPos, float Radius, FHitResult& OutHit) const
 {
-	const USphereComponent* Sphere = Cast<USphereComponent>(UpdatedComponent);
-	if (Sphere == nullptr)
+	const UPrimitiveComponent* Base = GroundQueryCache.SweepBase.Get();
+	if (Base == nullptr || Base != MovementBase.Get() || GroundQueryCache.bSweepHit == false || FMath::IsNearlyEqual(GroundQueryCache.SweepKey.Radius, Radius) == false)
 	{
-		return;
+		return false;
+	}
+	
+	const FTransform& BaseTransform = Base->GetComponentTransform();
+	if (FVector::DistSquared(BaseTransform.InverseTransformPosition(StartPos), GroundQueryCache.SweepBaseLocalStart) > FMath::Square(GroundQueryCacheTolerance))
+	{
+		return false;
+	}
+	
+	// 쿼리 당시 -> 현재 바닥 변환, 위쪽이 기울었으면(요 회전 외) 아래 방향 스윕 결과가 달라지므로 다시 쿼리
+	const FTransform BaseDelta = GroundQueryCache.SweepBaseTransform.Inverse() * BaseTransform;
+	if (BaseDelta.GetRotation().GetAxisZ().Z < 0.9999f)
+	{
+		return false;
 	}
+	
+	OutHit = GroundQueryCache.SweepHit;
+	OutHit.Location = BaseDelta.TransformPosition(OutHit.Location);
+	OutHit.ImpactPoint = BaseDelta.TransformPosition(OutHit.ImpactPoint);
+	OutHit.TraceStart = BaseDelta.TransformPosition(OutHit.TraceStart);
+	OutHit.TraceEnd = BaseDelta.TransformPosition(OutHit.TraceEnd);
+	OutHit.Normal = BaseDelta.TransformVectorNoScale(OutHit.Normal);
+	OutHit.ImpactNormal = BaseDelta.TransformVectorNoScale(OutHit.ImpactNormal);
+	INC_DWORD_STAT(STAT_SkullyGroundSweepsReusedOnBase);
+	
+	return true;
+}
 
-	// ImpactPoint에 구 반지름만큼 노멀 방향으로 올려서 구가 바닥에 딱 얹히게 함
-	const float Radius = Sphere->GetScaledSphereRadius();
-	const FVector TargetLocation = Hit.ImpactPoint + Hit.ImpactNormal * Radius;
+// 보조 바닥 감지: 구의 중심에서 아래로 짧은 라인트레이스
+bool USkullyMovementComponent::LineTraceGround(FHitResult& OutHit)
+{
+	const FVector StartPos = UpdatedComponent->GetComponentLocation();
+	
+	if (bUseGroundQueryCache == true && GroundQueryCache.LineKey.Matches(StartPos, 0.0f, GroundQueryCache.StepId, GroundQueryCacheTolerance) == true)
+	{
+		OutHit = GroundQueryCache.LineHit;
+		return GroundQueryCache.bLineHit;
+	}
+	
+	const FVector EndPos = StartPos - FVector::UpVector * GroundLineTraceDistance;
+	
+	const bool bComplexOnly = GroundProbeFidelity == ESkullyGroundProbeFidelity::Complex;
+	bool bHit = LineTraceGroundQuery(OutHit, StartPos, EndPos, bComplexOnly);
+	
+	// 바닥에 있던 중 단순 충돌로 걸을 수 있는 바닥을 못 찾았을 때만 Complex로 재확인
+	// 공중에서는 Sweep이 매번 실패해 여기로 오므로 재확인하지 않음(IsAmbiguousGroundHit와 같은 기준)
+	if (GroundProbeFidelity == ESkullyGroundProbeFidelity::Adaptive && MovementMode == ESkullyMovementMode::Grounded
+		&& (bHit == false || OutHit.ImpactNormal.Z < GetWalkableFloorZ()))
+	{
+		INC_DWORD_STAT(STAT_SkullyGroundProbeComplexFallback);
+		bHit = LineTraceGroundQuery(OutHit, StartPos, EndPos, true);
+	}
+	
+	GroundQueryCache.LineKey.Set(StartPos, 0.0f, GroundQueryCache.StepId, bHit == true && IsStaticHit(OutHit));
+	GroundQueryCache.LineHit = OutHit;
+	GroundQueryCache.bLineHit = bHit;
+	
+	return bHit;
+}
 
-	UpdatedComponent->SetWorldLocation(TargetLocation);
+// 바닥 Sphere Sweep 쿼리 1회
+bool USkullyMovementComponent::SweepGroundQuery(FHitResult& OutHit, const FVector& StartPos, const FVector& EndPos, const FCollisionShape& Shape, bool bTraceComplex) const
+{
+	// 자기 자신은 무시
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(SkullyGroundSweep), bTraceComplex);
+	Params.AddIgnoredActor(GetOwner());
+	INC_DWORD_STAT(STAT_SkullyGroundSweeps);
+	++QueryCounters.GroundSweeps;
+	SkullyCountGroundProbe(bTraceComplex);
+
+	// StartPos 지점에서 EndPos 지점까지 구를 Sweep하여 출력 매개 변수인 OutHit에 정보를 반환
+	return GetWorld()->SweepSingleByChannel(OutHit, StartPos, EndPos, FQuat::Identity, ECC_Visibility, Shape, Params);
 }
 
-namespace
+// 바닥 라인트레이스 쿼리 1회
+bool USkullyMovementComponent::LineTraceGroundQuery(FHitResult& OutHit, const FVector& StartPos, const FVector& EndPos, bool bTraceComplex) const
+{
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(SkullyGroundSweep), bTraceComplex);
+	Params.AddIgnoredActor(GetOwner());
+	INC_DWORD_STAT(STAT_SkullyGroundLineTraces);
+	++QueryCounters.GroundLineTraces;
+	SkullyCountGroundProbe(bTraceComplex);
+	
+	return GetWorld()->LineTraceSingleByChannel(OutHit, StartPos, EndPos, ECC_Visibility, Params);
+}
+
+// 단순 충돌 스윕 결과가 애매해서 Complex로 재확인해야 하는지
+bool USkullyMovementComponent::IsAmbiguousGroundHit(bool bHit, const FHitResult& Hit) const
+{
+	// 바닥에 있었는데 단순 충돌이 놓치는 경우(단순 충돌이 없는 메시, 단순 충돌 외곽이 실제 바닥보다 작은 경우)
+	// 공중에서는 재확인하지 않아 낙하 중 비용이 늘지 않음
+	if (bHit == false || Hit.bBlockingHit == false || Hit.Distance > MaxGroundDistance)
+	{
+		return MovementMode == ESkullyMovementMode::Grounded;
+	}
+	
+	if (Hit.bStartPenetrating == true)
+	{
+		return true;
+	}
+	
+	// Walkable 경계(GraceZ ~ WalkableZ)에 걸친 노멀은 단순 충돌의 근사 오차로 판정이 바뀔 수 있음
+	const float WalkableZ = GetWalkableFloorZ();
+	if (Hit.ImpactNormal.Z < WalkableZ && Hit.ImpactNormal.Z >= WalkableZ - GroundGraceZOffset)
+	{
+		return true;
+	}
+	
+	// 엣지/꼭짓점: 구 중심 방향 노멀(Normal)과 면 노멀(ImpactNormal)이 크게 다르면 모서리에 걸친 것
+	return FVector::DotProduct(Hit.Normal, Hit.ImpactNormal) < FloorNormalDotEdgeThreshold;
+}
+
+// 허용 경사각의 노멀 Z값
+float USkullyMovementComponent::GetWalkableFloorZ() const
 {
-	// 엣지/경계에서 CachedFloorNormal이 튀면서 슬라이드/투영이 0으로 붕괴할 수 있어, 
-	// 주변 바닥 높이를 샘플링해서 가장 아래로 향하는 downhill 방향을 구한다.
-	bool TryGetDownhillDirFromSamples(UWorld* World, const FVector& Origin, float SampleDist, float TraceDown, AActor* IgnoreActor, FVector& OutDir)
+	// 지면 판정마다 여러 번 불리므로 각도가 바뀔 때만 cos 계산
+	if (CachedWalkableSlopeAngle != MaxSlopeAngle)
 	{
-		if (World == nullptr || SampleDist <= KINDA_SMALL_NUMBER)
+		CachedWalkableSlopeAngle = MaxSlopeAngle;
+		CachedWalkableFloorZ = FMath::Cos(FMath::DegreesToRadians(MaxSlopeAngle));
+	}
+	
+	return CachedWalkableFloorZ;
+}
+
+// 주변 바닥 샘플링으로 downhill 방향 추정(캐시 사용)
+// 비동기 모드에서는 이번 스텝에 결과가 없을 수 있으며, 그 경우 false(이번 스텝은 슬라이드 보정 없음)
+// 네트워크 플레이에서는 항상 동기 샘플: 비동기 결과는 이전 틱/이전 위치 기준이라 클라이언트 예측, 서버의 ServerMove 처리,
+// ClientAdjustMove 재시뮬레이션이 서로 다른 방향을 보게 되고 경사 엣지에서 보정이 생김
+bool USkullyMovementComponent::GetDownhillDir(FVector& OutDir)
+{
+	const FVector Origin = UpdatedComponent->GetComponentLocation();
+	
+	if (bUseGroundQueryCache == false || GroundQueryCache.DownhillKey.Matches(Origin, 0.0f, GroundQueryCache.StepId, GroundQueryCacheTolerance) == false)
+	{
+		FSkullyDownhillSampleParams SampleParams;
+		SampleParams.Origin = Origin;
+		SampleParams.SampleDistance = DownhillSampleDistance;
+		SampleParams.TraceDown = GroundLineTraceDistance + 50.0f;
+		SampleParams.IgnoreActor = GetOwner();
+		SampleParams.NumDirections = static_cast<int32>(DownhillSampleCount);
+		// downhill 샘플은 높이만 비교하므로 Complex 모드에서만 삼각형 기반으로 감지
+		SampleParams.bTraceComplex = GroundProbeFidelity == ESkullyGroundProbeFidelity::Complex;
+		
+		FSkullyDownhillSampleResult Result;
+		if (bUseAsyncDownhillSamples == true && GetNetMode() == NM_Standalone)
 		{
-			return false;
+			const bool bResultReady = DownhillSampler.SampleAsync(GetWorld(), SampleParams, AsyncDownhillReuseDistance, Result);
+			QueryCounters.GroundLineTraces += Result.NumTracesIssued;
+			
+			if (bResultReady == false)
+			{
+				// 요청한 배치는 다음 틱에 소비
+				OutDir = FVector::ZeroVector;
+				return false;
+			}
+		}
+		else
+		{
+			FSkullyDownhillSampler::SampleSync(GetWorld(), SampleParams, Result);
+			QueryCounters.GroundLineTraces += Result.NumTracesIssued;
 		}
 		
-		FCollisionQueryParams Params(SCENE_QUERY_STAT(SkullyDownhillSample), false);
-		if (IgnoreActor != nullptr)
+		GroundQueryCache.bDownhillFound = Result.bFound;
+		GroundQueryCache.DownhillDir = Result.Dir;
+		GroundQueryCache.DownhillKey.Set(Origin, 0.0f, GroundQueryCache.StepId, Result.bAllStatic);
+	}
+	
+	OutDir = GroundQueryCache.DownhillDir;
+	return GroundQueryCache.bDownhillFound;
+}
+
+// 캐시된 바닥 정보를 다른 스텝에서도 재사용해도 되는 히트인지(움직이지 않는 Static 지오메트리)
+bool USkullyMovementComponent::IsStaticHit(const FHitResult& Hit)
+{
+	const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+	return HitComponent != nullptr && HitComponent->Mobility == EComponentMobility::Static;
+}
+
+void USkullyMovementComponent::InvalidateGroundQueryCache()
+{
+	GroundQueryCache.Invalidate();
+	DownhillSampler.Reset();
+}
+
+void USkullyMovementComponent::AddImpulse(const FVector& VelocityChange)
+{
+	Velocity += VelocityChange;
+	WakeUp();
+	
+	// 비동기 물리 모드에서는 물리 스레드 상태에 바로 반영
+	if (AsyncBodyId != INDEX_NONE)
+	{
+		if (USkullyAsyncMovementSubsystem* AsyncMovement = GetWorld()->GetSubsystem<USkullyAsyncMovementSubsystem>())
+		{
+			AsyncMovement->TeleportBody(AsyncBodyId, MakeKernelBodyState());
+		}
+	}
+}
+
+// 이동 상태 스냅샷(되감기/보정/프록시 복제용)
+FSkullyMovementSnapshot USkullyMovementComponent::CaptureSnapshot() const
+{
+	FSkullyMovementSnapshot Snapshot;
+	Snapshot.Location = UpdatedComponent != nullptr ? UpdatedComponent->GetComponentLocation() : FVector::ZeroVector;
+	Snapshot.Velocity = Velocity;
+	Snapshot.CachedFloorNormal = CachedFloorNormal;
+	Snapshot.LastFloorNormal = LastFloorNormal;
+	Snapshot.MovementMode = static_cast<uint8>(MovementMode);
+	Snapshot.bIsSlopeSliding = bIsSlopeSliding;
+	Snapshot.TimeAccumulator = TimeAccumulator;
+	
+	FSkullyNetInputMove InputMove;
+	InputMove.SetInput(FrameInput);
+	Snapshot.LastInputX = InputMove.InputX;
+	Snapshot.LastInputY = InputMove.InputY;
+	
+	return Snapshot;
+}
+
+void USkullyMovementComponent::RestoreSnapshot(const FSkullyMovementSnapshot& Snapshot)
+{
+	if (UpdatedComponent == nullptr)
+	{
+		return;
+	}
+	
+	// 스윕 없이 순간이동, 바닥 캐시는 새 위치 기준으로 다시 쿼리
+	UpdatedComponent->SetWorldLocation(Snapshot.Location, false, nullptr, ETeleportType::TeleportPhysics);
+	Velocity = Snapshot.Velocity;
+	CachedFloorNormal = Snapshot.CachedFloorNormal;
+	LastFloorNormal = Snapshot.LastFloorNormal;
+	MovementMode = Snapshot.MovementMode == static_cast<uint8>(ESkullyMovementMode::Grounded) ? ESkullyMovementMode::Grounded : ESkullyMovementMode::Falling;
+	bIsSlopeSliding = Snapshot.bIsSlopeSliding;
+	TimeAccumulator = Snapshot.TimeAccumulator;
+	PreviousStepLocation = Snapshot.Location;
+	
+	InvalidateGroundQueryCache();
+	UpdateMotionState();
+	
+	if (AsyncBodyId != INDEX_NONE)
+	{
+		if (USkullyAsyncMovementSubsystem* AsyncMovement = GetWorld()->GetSubsystem<USkullyAsyncMovementSubsystem>())
+		{
+			AsyncMovement->TeleportBody(AsyncBodyId, MakeKernelBodyState());
+		}
+	}
+}
+
+// 자율 프록시: 서버가 받을 양자화 입력/시간으로 예측 이동 후 무브 저장/전송
+void USkullyMovementComponent::TickAutonomousProxy(float DeltaTime, const FVector& Input)
+{
+	FSkullySavedMove NewMove;
+	NewMove.Move.Sequence = NextMoveSequence++;
+	NewMove.Move.SetInput(Input);
+	NewMove.Move.SetDeltaTime(FMath::Min(DeltaTime, SkullyNet::MaxMoveDeltaTime));
+	
+	PerformMove(NewMove.Move.GetDeltaTime(), NewMove.Move.GetInput());
+	NewMove.EndLocation = UpdatedComponent->GetComponentLocation();
+	
+	// 서버 응답이 오래 없으면 가장 오래된 무브부터 버림(이후 보정 시 그 구간은 재생되지 않음)
+	if (SavedMoves.Num() >= MaxSavedMoves)
+	{
+		SavedMoves.RemoveAt(0, SavedMoves.Num() - MaxSavedMoves + 1, EAllowShrinking::No);
+	}
+	SavedMoves.Add(NewMove);
+	
+	// 새 무브 + 확인받지 못한 이전 무브 일부
+	TArray<FSkullyNetInputMove> Moves;
+	const int32 FirstIndex = FMath::Max(0, SavedMoves.Num() - 1 - NetRedundantMoves);
+	for (int32 Index = FirstIndex; Index < SavedMoves.Num(); ++Index)
+	{
+		Moves.Add(SavedMoves[Index].Move);
+	}
+	
+	ServerMove(Moves, NewMove.EndLocation, LastReceivedStateSequence);
+	
+	// 페이로드 크기 추정: 무브당 6바이트 + 배열 길이 1바이트 + 양자화 위치 약 6바이트 + 받은 상태 시퀀스 2바이트
+	const uint32 PayloadBytes = Moves.Num() * 6 + 9;
+	++NetStats.MovesSent;
+	++NetStats.RpcsSent;
+	NetStats.BytesSent += PayloadBytes;
+	INC_DWORD_STAT(STAT_SkullyNetMovesSent);
+	INC_DWORD_STAT_BY(STAT_SkullyNetMoveBytes, PayloadBytes);
+}
+
+// 시뮬레이티드 프록시: 마지막으로 복제된 입력으로 추측 이동
+void USkullyMovementComponent::TickSimulatedProxy(float DeltaTime)
+{
+	PerformMove(DeltaTime, ProxyInput);
+}
+
+void USkullyMovementComponent::UpdateReplicatedState()
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		ReplicatedState = CaptureSnapshot();
+	}
+}
+
+void USkullyMovementComponent::UpdateNetSmoothing(float DeltaTime)
+{
+	if (NetSmoothingOffset.IsZero() == true)
+	{
+		return;
+	}
+	
+	// 지수 감쇠: NetSmoothingTime마다 약 63%씩 줄어듦
+	NetSmoothingOffset *= NetSmoothingTime > KINDA_SMALL_NUMBER ? FMath::Exp(-DeltaTime / NetSmoothingTime) : 0.0f;
+	if (NetSmoothingOffset.SizeSquared() < FMath::Square(0.1f))
+	{
+		NetSmoothingOffset = FVector::ZeroVector;
+	}
+	
+	ApplyVisualOffset(InterpolationOffset);
+}
+
+// 보정 전 위치에 메시가 그대로 보이도록 스무딩 오프셋을 더함, 너무 먼 보정은 바로 이동
+void USkullyMovementComponent::AddNetSmoothingOffset(const FVector& OldLocation)
+{
+	NetSmoothingOffset += OldLocation - UpdatedComponent->GetComponentLocation();
+	if (NetSmoothingOffset.SizeSquared() > FMath::Square(NetMaxSmoothingDistance))
+	{
+		NetSmoothingOffset = FVector::ZeroVector;
+	}
+	
+	ApplyVisualOffset(InterpolationOffset);
+}
+
+void USkullyMovementComponent::ServerMove_Implementation(const TArray<FSkullyNetInputMove>& Moves, FVector_NetQuantize10 ClientLocation, uint16 AckedStateSequence)
+{
+	if (UpdatedComponent == nullptr)
+	{
+		return;
+	}
+	
+	bool bProcessed = false;
+	for (const FSkullyNetInputMove& Move : Moves)
+	{
+		// 이미 처리한(중복 전송된) 무브는 건너뜀
+		if (SkullyNet::IsSequenceNewer(Move.Sequence, LastProcessedSequence) == false)
 		{
-			Params.AddIgnoredActor(IgnoreActor);;
+			continue;
 		}
-		Params.bTraceComplex = true;
-		Params.bReturnFaceIndex = true;
 		
-		// 기준 높이
-		float BaseZ = Origin.Z;
-		float BestZ = BaseZ;
-		FVector BestDir = FVector::ZeroVector;
+		// 비정상적으로 긴 시간 간격으로 한 번에 멀리 이동하는 것을 막음(클라이언트도 예측 시 같은 값으로 자르므로 변조된 무브만 보정받음)
+		PerformMove(FMath::Min(Move.GetDeltaTime(), SkullyNet::MaxMoveDeltaTime), Move.GetInput());
+		LastProcessedSequence = Move.Sequence;
+		bProcessed = true;
+	}
+	
+	if (bProcessed == false)
+	{
+		return;
+	}
+	
+	UpdateReplicatedState();
+	
+	// 마지막 무브 결과가 클라이언트 예측과 다르면 서버 상태로 보정
+	if (FVector::DistSquared(UpdatedComponent->GetComponentLocation(), ClientLocation) > FMath::Square(NetCorrectionThreshold))
+	{
+		// 클라이언트가 받았다고 알려준 상태가 남아 있으면 그 상태 기준 델타, 아니면(또는 주기적으로) 키프레임
+		const FSkullyMovementSnapshot* BaseState = nullptr;
+		if (AckedStateSequence != 0 && DeltaStatesSinceKeyframe < SkullyMovementStateCodec::GetKeyframeInterval())
+		{
+			BaseState = SentStates.Find(AckedStateSequence);
+		}
 		
-		const FVector Dirs[4] = { FVector::ForwardVector, FVector::RightVector, -FVector::ForwardVector, -FVector::RightVector};
-		for (const FVector& Dir : Dirs)
+		FSkullyPackedMovementState PackedState;
+		FSkullyMovementSnapshot QuantizedState;
+		if (SkullyMovementStateCodec::Pack(PackedState, CaptureSnapshot(), BaseState, AckedStateSequence, QuantizedState) == true)
 		{
-			const FVector SampleStart = Origin + Dir * SampleDist;
-			const FVector SampleEnd = SampleStart - FVector::UpVector * TraceDown;
+			// 서버도 양자화된 상태에서 이어서 시뮬레이션해야 클라이언트 재생 결과와 어긋나지 않음
+			RestoreSnapshot(QuantizedState);
+			UpdateReplicatedState();
 			
-			FHitResult Hit;
-			if (World->LineTraceSingleByChannel(Hit, SampleStart, SampleEnd, ECC_Visibility, Params) && Hit.bBlockingHit == true)
-			{
-				const float Z = Hit.ImpactPoint.Z;
-				if (Z < BestZ)
-				{
-					BestZ = Z;
-					BestDir = Dir;
-				}
-			}
+			SentStates.Add(LastProcessedSequence, QuantizedState);
+			DeltaStatesSinceKeyframe = PackedState.BaseSequence != 0 ? DeltaStatesSinceKeyframe + 1 : 0;
+			INC_DWORD_STAT_BY(STAT_SkullyNetStateBytes, (PackedState.NumBits + 7) / 8);
+			
+			ClientAdjustMove(LastProcessedSequence, PackedState);
 		}
+	}
+	else
+	{
+		ClientAckMove(LastProcessedSequence);
+	}
+}
+
+// 확인받은 시퀀스까지의 저장된 무브 제거
+void USkullyMovementComponent::RemoveAckedMoves(uint16 Sequence)
+{
+	int32 NumAcked = 0;
+	while (NumAcked < SavedMoves.Num() && SkullyNet::IsSequenceNewer(SavedMoves[NumAcked].Move.Sequence, Sequence) == false)
+	{
+		++NumAcked;
+	}
+	
+	SavedMoves.RemoveAt(0, NumAcked, EAllowShrinking::No);
+}
+
+void USkullyMovementComponent::ClientAckMove_Implementation(uint16 Sequence)
+{
+	// 순서가 뒤바뀌어 늦게 도착한 응답은 무시
+	if (SkullyNet::IsSequenceNewer(Sequence, LastAckedSequence) == false)
+	{
+		return;
+	}
+	
+	LastAckedSequence = Sequence;
+	++NetStats.Acks;
+	RemoveAckedMoves(Sequence);
+}
+
+void USkullyMovementComponent::ClientAdjustMove_Implementation(uint16 Sequence, const FSkullyPackedMovementState& PackedState)
+{
+	if (UpdatedComponent == nullptr || SkullyNet::IsSequenceNewer(Sequence, LastAckedSequence) == false)
+	{
+		return;
+	}
+	
+	// 기준 상태가 이미 기록에서 밀려났으면 복원할 수 없으므로 무시(다음 보정은 서버가 다른 기준 또는 키프레임으로 보냄)
+	const FSkullyMovementSnapshot* BaseState = PackedState.BaseSequence != 0 ? ReceivedStates.Find(PackedState.BaseSequence) : nullptr;
+	FSkullyMovementSnapshot ServerState;
+	if (SkullyMovementStateCodec::Unpack(PackedState, BaseState, ServerState) == false)
+	{
+		return;
+	}
+	
+	ReceivedStates.Add(Sequence, ServerState);
+	LastReceivedStateSequence = Sequence;
+	NetStats.StateBytesReceived += (PackedState.NumBits + 7) / 8;
+	NetStats.DeltaStatesReceived += PackedState.BaseSequence != 0 ? 1 : 0;
+	
+	LastAckedSequence = Sequence;
+	++NetStats.Corrections;
+	INC_DWORD_STAT(STAT_SkullyNetCorrections);
+	RemoveAckedMoves(Sequence);
+	
+	// 서버 상태로 되감은 뒤 아직 확인받지 못한 무브를 다시 시뮬레이션
+	// 재시뮬레이션 중에는 기믹 알림과 비주얼 트랜스폼 적용을 막고, 끝난 뒤 최종 상태로 한 번만 반영
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	const bool bPrevDeferVisualUpdate = bDeferVisualUpdate;
+	bIsReplayingMoves = true;
+	bDeferVisualUpdate = true;
+	
+	RestoreSnapshot(ServerState);
+	
+	for (FSkullySavedMove& SavedMove : SavedMoves)
+	{
+		PerformMove(SavedMove.Move.GetDeltaTime(), SavedMove.Move.GetInput());
+		SavedMove.EndLocation = UpdatedComponent->GetComponentLocation();
+	}
+	
+	bIsReplayingMoves = false;
+	bDeferVisualUpdate = bPrevDeferVisualUpdate;
+	
+	NetStats.ReplayedMoves += SavedMoves.Num();
+	INC_DWORD_STAT_BY(STAT_SkullyNetReplayedMoves, SavedMoves.Num());
+	
+	UpdateGimmickCell();
+	AddNetSmoothingOffset(OldLocation);
+}
+
+void USkullyMovementComponent::OnRep_ReplicatedState()
+{
+	if (UpdatedComponent == nullptr)
+	{
+		return;
+	}
+	
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+	RestoreSnapshot(ReplicatedState);
+	ProxyInput = FVector(ReplicatedState.LastInputX / SkullyNet::InputQuantizeScale, ReplicatedState.LastInputY / SkullyNet::InputQuantizeScale, 0.0f);
+	AddNetSmoothingOffset(OldLocation);
+}
+
+// 정지 판정: Grounded + 입력 없음 + 슬라이드 아님 + 속력이 SleepVelocityThreshold 이하 + 같은 바닥 위
+// 네트워크 플레이에서는 잠들지 않음: 잠듦 상태(bIsAsleep, RestTime)는 이동 스냅샷에 없으므로
+// 보정 후 재시뮬레이션이 서버와 다른 시점에 잠들거나 깨어날 수 있음
+void USkullyMovementComponent::UpdateSleepState(float DeltaTime)
+{
+	if (bEnableSleep == false || bIsAsleep == true || GetNetMode() != NM_Standalone)
+	{
+		return;
+	}
+	
+	UPrimitiveComponent* Floor = CurrentFloorHit.GetComponent();
+	const bool bResting = MovementMode == ESkullyMovementMode::Grounded && 
+		bIsSlopeSliding == false && 
+		FrameInput.IsNearlyZero() == true && 
+		Velocity.SizeSquared() <= FMath::Square(SleepVelocityThreshold) && 
+		bBaseMovedThisStep == false && 
+		Floor != nullptr;
+	
+	// 움직이거나 바닥이 바뀌었으면 처음부터 다시 잼
+	if (bResting == false || Floor != RestFloorComponent.Get())
+	{
+		RestTime = 0.0f;
+		RestFloorComponent = bResting ? Floor : nullptr;
+		return;
+	}
+	
+	RestTime += DeltaTime;
+	if (RestTime >= SleepDelay)
+	{
+		GoToSleep();
+	}
+}
+
+void USkullyMovementComponent::GoToSleep()
+{
+	bIsAsleep = true;
+	RestTime = 0.0f;
+	
+	// 남은 미세 속도/보간 상태 정리(깨어날 때 튀지 않도록)
+	Velocity = FVector::ZeroVector;
+	TimeAccumulator = 0.0f;
+	UnappliedInput = FVector::ZeroVector;
+	ApplyVisualOffset(FVector::ZeroVector);
+	UpdateMotionState();
+	
+	AwakeTickInterval = GetComponentTickInterval();
+	if (SleepTickInterval > 0.0f)
+	{
+		SetComponentTickInterval(SleepTickInterval);
+	}
+	else if (IsComponentTickEnabled() == true)
+	{
+		SetComponentTickEnabled(false);
+		bSleepDisabledTick = true;
+	}
+	
+	BindSleepWatchers();
+	
+	INC_DWORD_STAT(STAT_SkullySleepingBodies);
+	SkullyTraceMovementEvent(this, ESkullyMovementTraceEvent::Slept, UpdatedComponent->GetComponentLocation(), 0.0f);
+}
+
+void USkullyMovementComponent::WakeUp()
+{
+	if (bIsAsleep == false)
+	{
+		return;
+	}
+	
+	bIsAsleep = false;
+	RestTime = 0.0f;
+	UnbindSleepWatchers();
+	
+	SetComponentTickInterval(AwakeTickInterval);
+	if (bSleepDisabledTick == true)
+	{
+		bSleepDisabledTick = false;
+		SetComponentTickEnabled(true);
+	}
+	
+	DEC_DWORD_STAT(STAT_SkullySleepingBodies);
+	if (UpdatedComponent != nullptr)
+	{
+		SkullyTraceMovementEvent(this, ESkullyMovementTraceEvent::Woke, UpdatedComponent->GetComponentLocation(), Velocity.Size());
+	}
+}
+
+// 잠든 상태의 틱: 시뮬레이션 없이 바닥이 그대로인지만 확인
+// Static 바닥은 쿼리 캐시로 씬 쿼리 없이 끝나고, 움직일 수 있는 바닥만 다시 스윕한다
+void USkullyMovementComponent::TickAsleep()
+{
+	// 스텝 번호를 올려야 Static이 아닌 바닥의 캐시가 무효화됨
+	++GroundQueryCache.StepId;
+	
+	FHitResult Hit;
+	if (SweepGround(Hit) == true && Hit.Distance <= MaxGroundDistance && Hit.GetComponent() == RestFloorComponent.Get())
+	{
+		return;
+	}
+	
+	WakeUp();
+}
+
+void USkullyMovementComponent::BindSleepWatchers()
+{
+	UnbindSleepWatchers();
+	
+	// 바닥이 움직이면(이동 플랫폼, 엘리베이터 등) 깨어남
+	if (USceneComponent* Floor = RestFloorComponent.Get())
+	{
+		SleepWatchedFloor = Floor;
+		SleepFloorTransformHandle = Floor->TransformUpdated.AddUObject(this, &USkullyMovementComponent::OnSleepWatchedTransformUpdated);
 		
-		// 충분히 아래가 아니면 무시
-		if (BestDir.IsNearlyZero() == true)
+		if (AActor* FloorActor = Floor->GetOwner())
 		{
-			return false;
+			FloorActor->OnDestroyed.AddUniqueDynamic(this, &USkullyMovementComponent::OnSleepFloorActorDestroyed);
 		}
+	}
+	
+	// 자신이 외부에서 옮겨지면(텔레포트, 부모 이동 등) 깨어남
+	if (UpdatedComponent != nullptr)
+	{
+		SleepSelfTransformHandle = UpdatedComponent->TransformUpdated.AddUObject(this, &USkullyMovementComponent::OnSleepWatchedTransformUpdated);
+	}
+}
+
+void USkullyMovementComponent::UnbindSleepWatchers()
+{
+	if (USceneComponent* Floor = SleepWatchedFloor.Get())
+	{
+		Floor->TransformUpdated.Remove(SleepFloorTransformHandle);
 		
-		OutDir = BestDir.GetSafeNormal();
-		
-		return true;
+		if (AActor* FloorActor = Floor->GetOwner())
+		{
+			FloorActor->OnDestroyed.RemoveDynamic(this, &USkullyMovementComponent::OnSleepFloorActorDestroyed);
+		}
 	}
+	
+	if (UpdatedComponent != nullptr && SleepSelfTransformHandle.IsValid() == true)
+	{
+		UpdatedComponent->TransformUpdated.Remove(SleepSelfTransformHandle);
+	}
+	
+	SleepWatchedFloor.Reset();
+	SleepFloorTransformHandle.Reset();
+	SleepSelfTransformHandle.Reset();
+}
+
+void USkullyMovementComponent::OnSleepWatchedTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	// 바닥 또는 자신의 위치가 바뀌었으므로 캐시된 바닥 정보는 믿을 수 없음
+	InvalidateGroundQueryCache();
+	WakeUp();
+}
+
+void USkullyMovementComponent::OnSleepFloorActorDestroyed(AActor* DestroyedActor)
+{
+	InvalidateGroundQueryCache();
+	WakeUp();
+}
+
+// 구체 캐릭터가 바닥에 정확히 닿도록 위치를 보정
+// 착지 순간 지면에 파고들거나 떠 있는 오차를 제거하기 위한 스냅
+void USkullyMovementComponent::SnapToGround(const FHitResult& Hit)
+{
+	SKULLY_MOVEMENT_SCOPE(STAT_SkullySnapToGround, SkullyMovement_SnapToGround);
+	
+	const USphereComponent* Sphere = Cast<USphereComponent>(UpdatedComponent);
+	if (Sphere == nullptr)
+	{
+		return;
+	}
+
+	// ImpactPoint에 구 반지름만큼 노멀 방향으로 올려서 구가 바닥에 딱 얹히게 함
+	const float Radius = Sphere->GetScaledSphereRadius();
+	const FVector TargetLocation = Hit.ImpactPoint + Hit.ImpactNormal * Radius;
+
+	UpdatedComponent->SetWorldLocation(TargetLocation);
+}
+
+namespace
+{
+	FAutoConsoleCommandWithWorld NetStatsCommand(
+		TEXT("Skully.Net.Stats"),
+		TEXT("플레이어 Skully의 클라이언트 예측 통계(전송 무브/바이트, 보정 비율) 출력"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			const APawn* Pawn = World != nullptr ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+			const USkullyMovementComponent* Movement = Pawn != nullptr ? Pawn->FindComponentByClass<USkullyMovementComponent>() : nullptr;
+			if (Movement == nullptr)
+			{
+				return;
+			}
+			
+			const FSkullyNetPredictionStats& Stats = Movement->GetNetPredictionStats();
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Net] moves=%u rpcs=%u bytes=%u (%.1f B/move) acks=%u corrections=%u (%.2f%%) replayed=%u"),
+				Stats.MovesSent, Stats.RpcsSent, Stats.BytesSent, Stats.MovesSent > 0 ? static_cast<float>(Stats.BytesSent) / Stats.MovesSent : 0.0f,
+				Stats.Acks, Stats.Corrections, Stats.GetCorrectionRate() * 100.0f, Stats.ReplayedMoves);
+			UE_LOG(LogSkullyMovement, Display, TEXT("[Net] state bytes=%u (%.1f B/correction) delta=%u/%u"),
+				Stats.StateBytesReceived, Stats.Corrections > 0 ? static_cast<float>(Stats.StateBytesReceived) / Stats.Corrections : 0.0f,
+				Stats.DeltaStatesReceived, Stats.Corrections);
+		}));
 }
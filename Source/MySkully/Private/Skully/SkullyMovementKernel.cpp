@@ -0,0 +1,355 @@
+/*
+ * 파일명: SkullyMovementKernel.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 배치 스텝용 이동 모델 커널(중력/경사 투영/정지·운동 마찰/속도 제한)의 스칼라 경로와 4-wide SIMD(float) 경로
+ */
+
+#include "Skully/SkullyMovementKernel.h"
+
+void FSkullyMovementKernelLanes::SetLane(int32 Lane, const FVector& Velocity, const FVector& CachedFloorNormal, const FVector& LastFloorNormal, const FVector& Input, bool bGrounded, bool bIsSlopeSliding)
+{
+	const bool bHasInput = Input.IsNearlyZero() == false;
+	const FVector InputDir = bHasInput ? Input.GetSafeNormal() : FVector::ZeroVector;
+
+	VelocityX[Lane] = Velocity.X;
+	VelocityY[Lane] = Velocity.Y;
+	VelocityZ[Lane] = Velocity.Z;
+	CachedNormalX[Lane] = CachedFloorNormal.X;
+	CachedNormalY[Lane] = CachedFloorNormal.Y;
+	CachedNormalZ[Lane] = CachedFloorNormal.Z;
+	LastNormalX[Lane] = LastFloorNormal.X;
+	LastNormalY[Lane] = LastFloorNormal.Y;
+	LastNormalZ[Lane] = LastFloorNormal.Z;
+	InputDirX[Lane] = InputDir.X;
+	InputDirY[Lane] = InputDir.Y;
+	Grounded[Lane] = bGrounded ? 1.0f : 0.0f;
+	HasInput[Lane] = bHasInput ? 1.0f : 0.0f;
+	Sliding[Lane] = bIsSlopeSliding ? 1.0f : 0.0f;
+}
+
+void FSkullyMovementKernelLanes::ClearLane(int32 Lane)
+{
+	SetLane(Lane, FVector::ZeroVector, FVector::UpVector, FVector::UpVector, FVector::ZeroVector, false, false);
+}
+
+void SkullyMovementKernel::StepVelocity(FVector& Velocity, bool& bIsSlopeSliding, const FVector& CachedFloorNormal, const FVector& LastFloorNormal,
+	const FVector& Input, bool bGrounded, const FSkullyMovementModelParams& Params, float DeltaTime, FVector& OutMoveDelta)
+{
+	const bool bHasInput = Input.IsNearlyZero() == false;
+	const FVector InputDir = bHasInput ? Input.GetSafeNormal() : FVector::ZeroVector;
+
+	// 중력
+	SkullyMovementModel::ApplyGravity(Velocity, bGrounded, Params, DeltaTime);
+
+	// 경사 미끄러짐(Grounded + 입력 없음)
+	bool bSlopeSlideApplied = false;
+	if (bGrounded == true && bHasInput == false)
+	{
+		FVector UseNormal;
+		const FVector AlongPlane = SkullyMovementModel::ComputeSlopeGravity(CachedFloorNormal, LastFloorNormal, Params, UseNormal);
+		if (AlongPlane.SizeSquared() >= KINDA_SMALL_NUMBER)
+		{
+			bSlopeSlideApplied = SkullyMovementModel::ApplySlopeSlideAccel(Velocity, bIsSlopeSliding, AlongPlane, Params, DeltaTime);
+		}
+		else
+		{
+			bIsSlopeSliding = false;
+		}
+	}
+	else
+	{
+		bIsSlopeSliding = false;
+	}
+
+	// 마찰 + 입력 가속
+	SkullyMovementModel::ApplyFriction(Velocity, bGrounded, bIsSlopeSliding, bSlopeSlideApplied ? Params.SlidingFriction : Params.GroundFriction, Params, DeltaTime);
+	SkullyMovementModel::ApplyInputAcceleration(Velocity, InputDir, bHasInput, Params, DeltaTime);
+
+	// 이동량: Grounded면 바닥 평면으로 투영, 불안정 바닥에서는 수평 이동만
+	OutMoveDelta = Velocity * DeltaTime;
+	if (bGrounded == true)
+	{
+		OutMoveDelta = SkullyMovementModel::IsUnstableFloor(CachedFloorNormal, LastFloorNormal, Params)
+			? FVector(OutMoveDelta.X, OutMoveDelta.Y, 0.0f)
+			: FVector::VectorPlaneProject(OutMoveDelta, CachedFloorNormal);
+	}
+}
+
+void SkullyMovementKernel::StepVelocitiesScalar(FSkullyMovementKernelLanes& Lanes, const FSkullyMovementModelParams& Params, float DeltaTime)
+{
+	for (int32 Lane = 0; Lane < FSkullyMovementKernelLanes::Width; ++Lane)
+	{
+		FVector Velocity = Lanes.GetVelocity(Lane);
+		bool bIsSlopeSliding = Lanes.IsSliding(Lane);
+		const FVector CachedFloorNormal(Lanes.CachedNormalX[Lane], Lanes.CachedNormalY[Lane], Lanes.CachedNormalZ[Lane]);
+		const FVector LastFloorNormal(Lanes.LastNormalX[Lane], Lanes.LastNormalY[Lane], Lanes.LastNormalZ[Lane]);
+		const FVector Input(Lanes.InputDirX[Lane], Lanes.InputDirY[Lane], 0.0f);
+
+		FVector MoveDelta;
+		StepVelocity(Velocity, bIsSlopeSliding, CachedFloorNormal, LastFloorNormal, Input, Lanes.Grounded[Lane] > 0.0f, Params, DeltaTime, MoveDelta);
+
+		Lanes.VelocityX[Lane] = Velocity.X;
+		Lanes.VelocityY[Lane] = Velocity.Y;
+		Lanes.VelocityZ[Lane] = Velocity.Z;
+		Lanes.Sliding[Lane] = bIsSlopeSliding ? 1.0f : 0.0f;
+		Lanes.MoveX[Lane] = MoveDelta.X;
+		Lanes.MoveY[Lane] = MoveDelta.Y;
+		Lanes.MoveZ[Lane] = MoveDelta.Z;
+	}
+}
+
+namespace
+{
+	using FLane = VectorRegister4Float;
+
+	FORCEINLINE FLane LaneDot3(const FLane& AX, const FLane& AY, const FLane& AZ, const FLane& BX, const FLane& BY, const FLane& BZ)
+	{
+		return VectorMultiplyAdd(AX, BX, VectorMultiplyAdd(AY, BY, VectorMultiply(AZ, BZ)));
+	}
+
+	// 0이면 0, 아니면 제곱근(역제곱근 * 값)
+	FORCEINLINE FLane LaneSqrt(const FLane& SizeSquared)
+	{
+		return VectorMultiply(SizeSquared, VectorReciprocalSqrtAccurate(VectorMax(SizeSquared, VectorSetFloat1(SMALL_NUMBER))));
+	}
+
+	// FVector::GetClampedToMaxSize(MaxSize)를 XY에 적용, Mask가 켜진 레인만
+	FORCEINLINE void LaneClampSize2D(FLane& X, FLane& Y, float MaxSize, const FLane& Mask)
+	{
+		if (MaxSize < KINDA_SMALL_NUMBER)
+		{
+			X = VectorSelect(Mask, VectorZeroFloat(), X);
+			Y = VectorSelect(Mask, VectorZeroFloat(), Y);
+			return;
+		}
+
+		const FLane SizeSquared = VectorMultiplyAdd(X, X, VectorMultiply(Y, Y));
+		const FLane Over = VectorBitwiseAnd(Mask, VectorCompareGT(SizeSquared, VectorSetFloat1(MaxSize * MaxSize)));
+		const FLane Scale = VectorMultiply(VectorSetFloat1(MaxSize), VectorReciprocalSqrtAccurate(VectorMax(SizeSquared, VectorSetFloat1(SMALL_NUMBER))));
+		X = VectorSelect(Over, VectorMultiply(X, Scale), X);
+		Y = VectorSelect(Over, VectorMultiply(Y, Scale), Y);
+	}
+}
+
+void SkullyMovementKernel::StepVelocitiesSimd(FSkullyMovementKernelLanes& Lanes, const FSkullyMovementModelParams& Params, float DeltaTime)
+{
+	const FLane Zero = VectorZeroFloat();
+	const FLane One = VectorOneFloat();
+	const FLane KindaSmall = VectorSetFloat1(KINDA_SMALL_NUMBER);
+	const FLane DeltaTimeLane = VectorSetFloat1(DeltaTime);
+
+	FLane VelocityX = VectorLoadAligned(Lanes.VelocityX);
+	FLane VelocityY = VectorLoadAligned(Lanes.VelocityY);
+	FLane VelocityZ = VectorLoadAligned(Lanes.VelocityZ);
+	const FLane CachedX = VectorLoadAligned(Lanes.CachedNormalX);
+	const FLane CachedY = VectorLoadAligned(Lanes.CachedNormalY);
+	const FLane CachedZ = VectorLoadAligned(Lanes.CachedNormalZ);
+	const FLane LastX = VectorLoadAligned(Lanes.LastNormalX);
+	const FLane LastY = VectorLoadAligned(Lanes.LastNormalY);
+	const FLane LastZ = VectorLoadAligned(Lanes.LastNormalZ);
+
+	const FLane GroundedMask = VectorCompareGT(VectorLoadAligned(Lanes.Grounded), Zero);
+	const FLane NoInputMask = VectorCompareLE(VectorLoadAligned(Lanes.HasInput), Zero);
+	const FLane SlidingMask = VectorCompareGT(VectorLoadAligned(Lanes.Sliding), Zero);
+	const FLane NotSlidingMask = VectorCompareLE(VectorLoadAligned(Lanes.Sliding), Zero);
+
+	// 중력: Falling이면 하강 가속, Grounded면 Z 속도 최소 0
+	VelocityZ = VectorSelect(GroundedMask, VectorMax(VelocityZ, Zero), VectorSubtract(VelocityZ, VectorSetFloat1(Params.Gravity * DeltaTime)));
+
+	// 불안정 바닥: 노멀이 충분히 위를 향하지 않거나 직전 노멀과 많이 다름
+	const FLane UnstableMask = VectorBitwiseOr(
+		VectorCompareLT(CachedZ, VectorSetFloat1(Params.UnstableFloorZThreshold)),
+		VectorCompareLT(LaneDot3(CachedX, CachedY, CachedZ, LastX, LastY, LastZ), VectorSetFloat1(Params.FloorNormalDotEdgeThreshold)));
+
+	// 경사 미끄러짐(Grounded + 입력 없음)
+	// 슬라이드 노멀(불안정하면 직전 노멀) 정규화, 길이가 0이면 0
+	FLane NormalX = VectorSelect(UnstableMask, LastX, CachedX);
+	FLane NormalY = VectorSelect(UnstableMask, LastY, CachedY);
+	FLane NormalZ = VectorSelect(UnstableMask, LastZ, CachedZ);
+	const FLane NormalSizeSquared = LaneDot3(NormalX, NormalY, NormalZ, NormalX, NormalY, NormalZ);
+	const FLane ValidNormalMask = VectorCompareGT(NormalSizeSquared, VectorSetFloat1(SMALL_NUMBER));
+	const FLane InvNormalSize = VectorReciprocalSqrtAccurate(VectorMax(NormalSizeSquared, VectorSetFloat1(SMALL_NUMBER)));
+	NormalX = VectorSelect(ValidNormalMask, VectorMultiply(NormalX, InvNormalSize), Zero);
+	NormalY = VectorSelect(ValidNormalMask, VectorMultiply(NormalY, InvNormalSize), Zero);
+	NormalZ = VectorSelect(ValidNormalMask, VectorMultiply(NormalZ, InvNormalSize), Zero);
+
+	// 중력(0, 0, -G)의 평면 성분 = G * (Nx * Nz, Ny * Nz, Nz * Nz - 1)
+	const FLane GravityLane = VectorSetFloat1(Params.Gravity);
+	const FLane AlongX = VectorMultiply(GravityLane, VectorMultiply(NormalX, NormalZ));
+	const FLane AlongY = VectorMultiply(GravityLane, VectorMultiply(NormalY, NormalZ));
+	const FLane AlongZ = VectorMultiply(GravityLane, VectorSubtract(VectorMultiply(NormalZ, NormalZ), One));
+	const FLane HasAlongMask = VectorCompareGE(LaneDot3(AlongX, AlongY, AlongZ, AlongX, AlongY, AlongZ), KindaSmall);
+
+	const FLane ScaleLane = VectorSetFloat1(Params.SlopeSlideScale);
+	const FLane AccelX = VectorMultiply(AlongX, ScaleLane);
+	const FLane AccelY = VectorMultiply(AlongY, ScaleLane);
+	const FLane AccelZ = VectorMultiply(AlongZ, ScaleLane);
+	const FLane AccelSize = LaneSqrt(LaneDot3(AccelX, AccelY, AccelZ, AccelX, AccelY, AccelZ));
+	const FLane InvAccelSize = VectorReciprocalAccurate(VectorMax(AccelSize, KindaSmall));
+	const FLane SlideDirX = VectorMultiply(AccelX, InvAccelSize);
+	const FLane SlideDirY = VectorMultiply(AccelY, InvAccelSize);
+
+	const FLane CandidateMask = VectorBitwiseAnd(VectorBitwiseAnd(GroundedMask, NoInputMask), VectorBitwiseAnd(HasAlongMask, VectorCompareGT(AccelSize, KindaSmall)));
+	// 슬라이딩 유지(히스테리시스): 정지 마찰의 절반 이상, 시작: 정지 마찰 초과
+	const FLane KeepMask = VectorBitwiseAnd(SlidingMask, VectorCompareGE(AccelSize, VectorSetFloat1(Params.StaticFrictionAccel * 0.5f)));
+	const FLane StartMask = VectorBitwiseAnd(CandidateMask, VectorBitwiseAnd(NotSlidingMask, VectorCompareGT(AccelSize, VectorSetFloat1(Params.StaticFrictionAccel))));
+	const FLane AppliedMask = VectorBitwiseOr(VectorBitwiseAnd(CandidateMask, KeepMask), StartMask);
+
+	const FLane WasNearlyZeroMask = VectorCompareLT(VectorMultiplyAdd(VelocityX, VelocityX, VectorMultiply(VelocityY, VelocityY)), One);
+	const FLane SlideStep = VectorMultiply(AccelSize, DeltaTimeLane);
+	VelocityX = VectorSelect(AppliedMask, VectorMultiplyAdd(SlideDirX, SlideStep, VelocityX), VelocityX);
+	VelocityY = VectorSelect(AppliedMask, VectorMultiplyAdd(SlideDirY, SlideStep, VelocityY), VelocityY);
+
+	// 정지 상태에서 막 미끄러지기 시작하면 최소 시작 속도 보장
+	{
+		const FLane Speed = LaneSqrt(VectorMultiplyAdd(VelocityX, VelocityX, VectorMultiply(VelocityY, VelocityY)));
+		const FLane MinStartSpeed = VectorSetFloat1(Params.MinSlopeSlideStartSpeed);
+		const FLane BoostMask = VectorBitwiseAnd(VectorBitwiseAnd(StartMask, WasNearlyZeroMask), VectorBitwiseAnd(VectorCompareGT(Speed, KindaSmall), VectorCompareLT(Speed, MinStartSpeed)));
+		VelocityX = VectorSelect(BoostMask, VectorMultiply(SlideDirX, MinStartSpeed), VelocityX);
+		VelocityY = VectorSelect(BoostMask, VectorMultiply(SlideDirY, MinStartSpeed), VelocityY);
+	}
+
+	LaneClampSize2D(VelocityX, VelocityY, Params.MaxSlopeSlideSpeed, AppliedMask);
+	const FLane NewSlidingMask = AppliedMask;
+
+	// 마찰: 슬라이딩 중에는 속도 비례 감쇠, 그 외에는 고정 감속(속도보다 크면 0)
+	{
+		const FLane HasHorizontalMask = VectorBitwiseOr(VectorCompareGT(VectorAbs(VelocityX), KindaSmall), VectorCompareGT(VectorAbs(VelocityY), KindaSmall));
+		const FLane Friction = VectorSelect(GroundedMask,
+			VectorSelect(AppliedMask, VectorSetFloat1(Params.SlidingFriction), VectorSetFloat1(Params.GroundFriction)),
+			VectorSetFloat1(Params.AirFriction));
+		const FLane DecelSize = VectorMultiply(Friction, DeltaTimeLane);
+
+		const FLane SizeSquared = VectorMultiplyAdd(VelocityX, VelocityX, VectorMultiply(VelocityY, VelocityY));
+		const FLane StopMask = VectorCompareGE(VectorMultiply(DecelSize, DecelSize), SizeSquared);
+		const FLane DecelScale = VectorMultiply(DecelSize, VectorReciprocalSqrtAccurate(VectorMax(SizeSquared, VectorSetFloat1(SMALL_NUMBER))));
+		FLane FrictionX = VectorSelect(StopMask, Zero, VectorSubtract(VelocityX, VectorMultiply(VelocityX, DecelScale)));
+		FLane FrictionY = VectorSelect(StopMask, Zero, VectorSubtract(VelocityY, VectorMultiply(VelocityY, DecelScale)));
+
+		const FLane DampMask = VectorBitwiseAnd(GroundedMask, NewSlidingMask);
+		const FLane DampFactor = VectorSetFloat1(FMath::Clamp(1.0f - Params.SlideDamping * DeltaTime, 0.0f, 1.0f));
+		FrictionX = VectorSelect(DampMask, VectorMultiply(VelocityX, DampFactor), FrictionX);
+		FrictionY = VectorSelect(DampMask, VectorMultiply(VelocityY, DampFactor), FrictionY);
+
+		VelocityX = VectorSelect(HasHorizontalMask, FrictionX, VelocityX);
+		VelocityY = VectorSelect(HasHorizontalMask, FrictionY, VelocityY);
+	}
+
+	// 입력 가속: 목표 속도로 일정 가속(VInterpConstantTo) + 최대 속력 제한
+	{
+		const FLane MaxSpeedLane = VectorSetFloat1(Params.MaxSpeed);
+		const FLane TargetX = VectorMultiply(VectorLoadAligned(Lanes.InputDirX), MaxSpeedLane);
+		const FLane TargetY = VectorMultiply(VectorLoadAligned(Lanes.InputDirY), MaxSpeedLane);
+		const FLane HasTargetMask = VectorBitwiseOr(VectorCompareGT(VectorAbs(TargetX), KindaSmall), VectorCompareGT(VectorAbs(TargetY), KindaSmall));
+
+		const FLane ToTargetX = VectorSubtract(TargetX, VelocityX);
+		const FLane ToTargetY = VectorSubtract(TargetY, VelocityY);
+		const FLane ToTargetSize = LaneSqrt(VectorMultiplyAdd(ToTargetX, ToTargetX, VectorMultiply(ToTargetY, ToTargetY)));
+		const float MaxStep = Params.Acceleration * DeltaTime;
+		const FLane FarMask = VectorCompareGT(ToTargetSize, VectorSetFloat1(MaxStep));
+
+		FLane StepX = VelocityX;
+		FLane StepY = VelocityY;
+		if (MaxStep > 0.0f)
+		{
+			const FLane StepScale = VectorMultiply(VectorSetFloat1(MaxStep), VectorReciprocalAccurate(VectorMax(ToTargetSize, KindaSmall)));
+			StepX = VectorMultiplyAdd(ToTargetX, StepScale, VelocityX);
+			StepY = VectorMultiplyAdd(ToTargetY, StepScale, VelocityY);
+		}
+
+		VelocityX = VectorSelect(HasTargetMask, VectorSelect(FarMask, StepX, TargetX), VelocityX);
+		VelocityY = VectorSelect(HasTargetMask, VectorSelect(FarMask, StepY, TargetY), VelocityY);
+
+		LaneClampSize2D(VelocityX, VelocityY, Params.MaxSpeed, VectorCompareEQ(Zero, Zero));
+	}
+
+	// 이동량: Grounded면 바닥 평면 투영, 불안정 바닥이면 수평 이동만
+	const FLane MoveX = VectorMultiply(VelocityX, DeltaTimeLane);
+	const FLane MoveY = VectorMultiply(VelocityY, DeltaTimeLane);
+	const FLane MoveZ = VectorMultiply(VelocityZ, DeltaTimeLane);
+	const FLane MoveDotNormal = LaneDot3(MoveX, MoveY, MoveZ, CachedX, CachedY, CachedZ);
+	const FLane ProjectedX = VectorSelect(UnstableMask, MoveX, VectorSubtract(MoveX, VectorMultiply(CachedX, MoveDotNormal)));
+	const FLane ProjectedY = VectorSelect(UnstableMask, MoveY, VectorSubtract(MoveY, VectorMultiply(CachedY, MoveDotNormal)));
+	const FLane ProjectedZ = VectorSelect(UnstableMask, Zero, VectorSubtract(MoveZ, VectorMultiply(CachedZ, MoveDotNormal)));
+
+	VectorStoreAligned(VelocityX, Lanes.VelocityX);
+	VectorStoreAligned(VelocityY, Lanes.VelocityY);
+	VectorStoreAligned(VelocityZ, Lanes.VelocityZ);
+	VectorStoreAligned(VectorSelect(NewSlidingMask, One, Zero), Lanes.Sliding);
+	VectorStoreAligned(VectorSelect(GroundedMask, ProjectedX, MoveX), Lanes.MoveX);
+	VectorStoreAligned(VectorSelect(GroundedMask, ProjectedY, MoveY), Lanes.MoveY);
+	VectorStoreAligned(VectorSelect(GroundedMask, ProjectedZ, MoveZ), Lanes.MoveZ);
+}
+
+void SkullyMovementKernel::MoveSphere(FSkullyKernelBodyState& Body, const FVector& MoveDelta, float Radius, const FSkullyMovementModelParams& Params, float DeltaTime, FSkullyKernelSweepFunction Sweep)
+{
+	FVector& Position = Body.Position;
+
+	// Sweep 이동 + 막히면 충돌면을 따라 한 번 미끄러짐
+	if (MoveDelta.IsNearlyZero() == false)
+	{
+		FHitResult Hit;
+		if (Sweep(Hit, Position, Position + MoveDelta, ECC_Pawn) == true)
+		{
+			if (Hit.bStartPenetrating == true)
+			{
+				// 겹친 상태로 시작하면 밀어내기만 하고 이번 스텝 이동은 포기
+				Position += Hit.Normal * (Hit.PenetrationDepth + 0.125f);
+			}
+			else
+			{
+				Position = Hit.Location;
+
+				const FVector SlideDelta = FVector::VectorPlaneProject(MoveDelta * (1.0f - Hit.Time), Hit.Normal);
+				if (SlideDelta.IsNearlyZero() == false)
+				{
+					FHitResult SlideHit;
+					Position = Sweep(SlideHit, Position, Position + SlideDelta, ECC_Pawn) == true ? SlideHit.Location : Position + SlideDelta;
+				}
+			}
+		}
+		else
+		{
+			Position += MoveDelta;
+		}
+	}
+
+	// 지면 판정
+	const bool bWasGrounded = Body.bGrounded;
+	Body.bGrounded = false;
+
+	FHitResult GroundHit;
+	const FVector GroundEnd = Position - FVector::UpVector * (Radius + Params.GroundCheckDistance);
+	if (Sweep(GroundHit, Position, GroundEnd, ECC_Visibility) == true && GroundHit.Distance <= Params.MaxGroundDistance)
+	{
+		const float HitZ = GroundHit.ImpactNormal.Z;
+		const bool bWalkable = HitZ >= Params.WalkableFloorZ;
+
+		if (bWalkable == true || (bWasGrounded == true && HitZ >= Params.WalkableFloorZ - Params.GroundGraceZOffset))
+		{
+			Body.bGrounded = true;
+
+			const bool bIsSlope = HitZ < Params.FlatGroundZThreshold;
+			if (bIsSlope == false)
+			{
+				Body.LastFloorNormal = FVector::UpVector;
+				Body.CachedFloorNormal = FVector::UpVector;
+				Body.bIsSlopeSliding = false;
+			}
+			else
+			{
+				Body.LastFloorNormal = Body.CachedFloorNormal;
+				Body.CachedFloorNormal = FMath::VInterpNormalRotationTo(
+					Body.CachedFloorNormal.IsNearlyZero() ? GroundHit.ImpactNormal : Body.CachedFloorNormal,
+					GroundHit.ImpactNormal, DeltaTime, Params.FloorNormalInterpSpeed);
+			}
+
+			// 평지 착지 순간에만 바닥에 스냅
+			if (bWasGrounded == false && bWalkable == true && bIsSlope == false && Body.Velocity.Z <= 0.0f)
+			{
+				Position = GroundHit.ImpactPoint + GroundHit.ImpactNormal * Radius;
+			}
+		}
+	}
+}
@@ -0,0 +1,173 @@
+/*
+ * 파일명: SkullyMovementModel.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 모델(중력/경사 미끄러짐/마찰/입력 가속)의 순수 계산 함수
+ */
+
+#include "Skully/SkullyMovementModel.h"
+
+void SkullyMovementModel::ApplyGravity(FVector& Velocity, bool bGrounded, const FSkullyMovementModelParams& Params, float DeltaTime)
+{
+	// Falling일 때만 중력 가속을 적용해서 낙하
+	if (bGrounded == false)
+	{
+		Velocity.Z -= Params.Gravity * DeltaTime;
+	}
+	// Grounded 상태에서는 중력으로 바닥을 파고들지 않도록 Z 속도를 최소 0으로 유지
+	else
+	{
+		Velocity.Z = FMath::Max(Velocity.Z, 0.0f);
+	}
+}
+
+bool SkullyMovementModel::IsUnstableFloor(const FVector& CachedFloorNormal, const FVector& LastFloorNormal, const FSkullyMovementModelParams& Params)
+{
+	// 현재 바닥의 노멀과 이전 프레임 바닥의 노멀의 내적: 현재 바닥 노멀과 이전 프레임 바닥 노멀의 변화량
+	const float NormalDot = FVector::DotProduct(CachedFloorNormal, LastFloorNormal);
+	// 조건1: 바닥이 충분히 평평하지 않거나(경사), 노멀 자체가 수직인 특이 케이스
+	// 조건2: 노멀 변화량이 급격히 달라진 경우(면-면 경계/엣지)
+	return CachedFloorNormal.Z < Params.UnstableFloorZThreshold || NormalDot < Params.FloorNormalDotEdgeThreshold;
+}
+
+FVector SkullyMovementModel::ComputeSlopeGravity(const FVector& CachedFloorNormal, const FVector& LastFloorNormal, const FSkullyMovementModelParams& Params, FVector& OutUseNormal)
+{
+	const FVector GravityVector(0.0f, 0.0f, -Params.Gravity);
+	// 불안정 바닥에서는 CachedFloorNormal이 튀는 프레임이 있으므로, 슬라이드에 사용할 노멀을 안정화하여 UseNormal에 적용
+	OutUseNormal = IsUnstableFloor(CachedFloorNormal, LastFloorNormal, Params) ? LastFloorNormal : CachedFloorNormal;
+	OutUseNormal = OutUseNormal.GetSafeNormal();
+	// 중력 벡터를 바닥 평면에 투영하여 미끄러짐 생성
+	return FVector::VectorPlaneProject(GravityVector, OutUseNormal);
+}
+
+bool SkullyMovementModel::ApplySlopeSlideAccel(FVector& Velocity, bool& bIsSlopeSliding, const FVector& AlongPlane, const FSkullyMovementModelParams& Params, float DeltaTime)
+{
+	// 슬라이드 가속 스케일 적용
+	const FVector SlideAccel = AlongPlane * Params.SlopeSlideScale;
+	const float SlideAccelMag = SlideAccel.Size();
+
+	if (SlideAccelMag <= KINDA_SMALL_NUMBER)
+	{
+		bIsSlopeSliding = false;
+		return false;
+	}
+
+	const FVector SlideDir = SlideAccel.GetSafeNormal();
+
+	// 슬라이딩 종료(히스테리시스): 슬라이딩 상태일 때 가속이 너무 작으면 시작 안함
+	const float StopThreshold = Params.StaticFrictionAccel * 0.5f;
+	if (bIsSlopeSliding == true && SlideAccelMag < StopThreshold)
+	{
+		bIsSlopeSliding = false;
+		return false;
+	}
+
+	// 시작(Static friction): 아직 슬라이딩 중이 아니면 정지 마찰을 이겨야 시작
+	bool bStartedSlidingThisFrame = false;
+	if (bIsSlopeSliding == false)
+	{
+		if (SlideAccelMag <= Params.StaticFrictionAccel)
+		{
+			// 정지 마찰이 이기면 슬라이드 시작을 허용하지 않는다.
+			// 여기서 Velocity를 0으로 강제하면(특히 엣지/경계에서 노멀이 흔들릴 때)
+			// 속도 리셋 -> 다음 프레임 보정 이동같은 에너지 폭발이 생길 수 있어 건드리지 않는다.
+			return false;
+		}
+
+		// 여기까지 왔으면 미끄러지기 시작
+		bIsSlopeSliding = true;
+		bStartedSlidingThisFrame = true;
+	}
+
+	// 슬라이드 적용 전(이번 프레임 시작 시점)의 수평 속도
+	const FVector Vel2DBefore(Velocity.X, Velocity.Y, 0.f);
+	const bool bWasNearlyZero = (Vel2DBefore.SizeSquared() < FMath::Square(1.0f));
+
+	// 유지(Kinetic friction): 정지 마찰을 이긴 만큼만 가속(부드러운 시작)
+	Velocity.X += SlideDir.X * SlideAccelMag * DeltaTime;
+	Velocity.Y += SlideDir.Y * SlideAccelMag * DeltaTime;
+
+	// 아주 작은 속도에서 한 프레임 멈칫하는 현상 방지: 최소 시작 속도 보장
+	if (bStartedSlidingThisFrame == true && bWasNearlyZero == true)
+	{
+		FVector Velocity2D(Velocity.X, Velocity.Y, 0.0f);
+		const float Speed2D = Velocity2D.Size();
+
+		if (Speed2D > KINDA_SMALL_NUMBER && Speed2D < Params.MinSlopeSlideStartSpeed)
+		{
+			Velocity2D = SlideDir * Params.MinSlopeSlideStartSpeed;
+			Velocity.X = Velocity2D.X;
+			Velocity.Y = Velocity2D.Y;
+		}
+	}
+
+	// 속도 제한
+	FVector Velocity2D(Velocity.X, Velocity.Y, 0.0f);
+	Velocity2D = Velocity2D.GetClampedToMaxSize(Params.MaxSlopeSlideSpeed);
+	Velocity.X = Velocity2D.X;
+	Velocity.Y = Velocity2D.Y;
+
+	return true;
+}
+
+void SkullyMovementModel::ApplyFriction(FVector& Velocity, bool bGrounded, bool bIsSlopeSliding, float GroundedFriction, const FSkullyMovementModelParams& Params, float DeltaTime)
+{
+	// Grounded/Air 상태에 따라 마찰 계수 다르게 사용
+	const float Friction = bGrounded ? GroundedFriction : Params.AirFriction;
+
+	FVector HorizontalVelocity(Velocity.X, Velocity.Y, 0.0f);
+
+	if (HorizontalVelocity.IsNearlyZero() == true)
+	{
+		return;
+	}
+
+	// 슬라이딩 중에는 고정 감속(브레이킹) 대신 속도 비례 감쇠(댐핑)를 사용한다.
+	// 고정 감속은 저속에서 0으로 스냅되며 툭툭 끊김이 생기기 쉽다
+	// 댐핑은 속도가 높을수록 더 많이 감쇠되어 자연스러운 종단속도(terminal speed)를 만든다.
+	if (bGrounded == true && bIsSlopeSliding == true)
+	{
+		const float Factor = FMath::Clamp(1.0f - Params.SlideDamping * DeltaTime, 0.0f, 1.0f);
+		HorizontalVelocity *= Factor;
+	}
+	else
+	{
+		// Friction은 초당 감속량처럼 동작
+		const FVector Decel = -HorizontalVelocity.GetSafeNormal() * Friction * DeltaTime;
+
+		if (Decel.SizeSquared() >= HorizontalVelocity.SizeSquared())
+		{
+			HorizontalVelocity = FVector::ZeroVector;
+		}
+		else
+		{
+			HorizontalVelocity += Decel;
+		}
+	}
+
+	// 마찰은 XY에만 적용
+	Velocity.X = HorizontalVelocity.X;
+	Velocity.Y = HorizontalVelocity.Y;
+}
+
+void SkullyMovementModel::ApplyInputAcceleration(FVector& Velocity, const FVector& InputDir, bool bHasInput, const FSkullyMovementModelParams& Params, float DeltaTime)
+{
+	// 목표 힘
+	FVector TargetVelocity2D = FVector::ZeroVector;
+	if (bHasInput == true)
+	{
+		TargetVelocity2D = FVector(InputDir.X, InputDir.Y, 0.0f) * Params.MaxSpeed;
+	}
+
+	// 현재 힘
+	FVector CurrentVelocity2D(Velocity.X, Velocity.Y, 0.0f);
+	if (TargetVelocity2D.IsNearlyZero() == false)
+	{
+		// 가속
+		CurrentVelocity2D = FMath::VInterpConstantTo(CurrentVelocity2D, TargetVelocity2D, DeltaTime, Params.Acceleration);
+	}
+
+	CurrentVelocity2D = CurrentVelocity2D.GetClampedToMaxSize(Params.MaxSpeed);
+	Velocity.X = CurrentVelocity2D.X;
+	Velocity.Y = CurrentVelocity2D.Y;
+}
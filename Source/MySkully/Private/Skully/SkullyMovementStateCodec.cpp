@@ -0,0 +1,485 @@
+/*
+ * 파일명: SkullyMovementStateCodec.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 상태 양자화/비트 패킹(키프레임, 기준 상태 대비 델타)과 시퀀스별 상태 기록
+ */
+
+#include "Skully/SkullyMovementStateCodec.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarVelocityBits(
+		TEXT("Skully.Net.VelocityBits"),
+		16,
+		TEXT("Skully 이동 상태 속도 성분당 비트 수(4~24, 범위 +-8192cm/s)"));
+
+	TAutoConsoleVariable<int32> CVarNormalBits(
+		TEXT("Skully.Net.NormalBits"),
+		12,
+		TEXT("Skully 이동 상태 바닥 노멀(옥타헤드럴) 축당 비트 수(4~15)"));
+
+	TAutoConsoleVariable<int32> CVarKeyframeInterval(
+		TEXT("Skully.Net.KeyframeInterval"),
+		32,
+		TEXT("델타 보정을 이 횟수만큼 보낸 뒤 키프레임을 강제로 보냄"));
+
+	// 속도 양자화 범위(cm/s), MaxSlopeSlideSpeed(6000)와 긴 낙하 속도를 포함
+	constexpr float VelocityRange = 8192.0f;
+
+	enum EStateFlags : uint32
+	{
+		Flag_Grounded = 1 << 0,
+		Flag_Sliding = 1 << 1,
+		Flag_VelocityZero = 1 << 2,
+		Flag_VelocitySame = 1 << 3,
+		Flag_NormalsUp = 1 << 4,
+		Flag_LastEqualsCached = 1 << 5,
+		Flag_NormalsSame = 1 << 6,
+		Flag_HasInput = 1 << 7,
+		Flag_HasAccumulator = 1 << 8,
+		Flag_LocationSame = 1 << 9
+	};
+	constexpr int32 NumFlagBits = 10;
+
+	// 수신 시에는 Value를 0으로 초기화한 뒤 하위 NumBits만 채움
+	void SerializeFixedBits(FArchive& Ar, uint32& Value, int32 NumBits)
+	{
+		if (Ar.IsLoading() == true)
+		{
+			Value = 0;
+		}
+
+		Ar.SerializeBits(&Value, NumBits);
+	}
+
+	int64 QuantizeCm(double Value)
+	{
+		return FMath::RoundToInt64(Value * 100.0);
+	}
+
+	uint32 ZigZag(int32 Value)
+	{
+		return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	}
+
+	int32 UnZigZag(uint32 Value)
+	{
+		return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+	}
+
+	uint32 QuantizeSigned(double Value, int32 Bits)
+	{
+		const int32 MaxQ = (1 << (Bits - 1)) - 1;
+		return static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(Value / VelocityRange * MaxQ), -MaxQ, MaxQ) + MaxQ);
+	}
+
+	double DequantizeSigned(uint32 Quantized, int32 Bits)
+	{
+		const int32 MaxQ = (1 << (Bits - 1)) - 1;
+		return static_cast<double>(static_cast<int32>(Quantized) - MaxQ) / MaxQ * VelocityRange;
+	}
+}
+
+bool SkullyMovementStateCodec::IsLocationDeltaEncodable(const FVector& Location, const FVector& BaseLocation)
+{
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const int64 Delta = QuantizeCm(Location[Axis]) - QuantizeCm(BaseLocation[Axis]);
+		if (Delta <= MIN_int32 / 2 || Delta >= MAX_int32 / 2)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FSkullyMovementStateQuantization SkullyMovementStateCodec::GetQuantization()
+{
+	FSkullyMovementStateQuantization Quantization;
+	Quantization.VelocityBits = FMath::Clamp(CVarVelocityBits.GetValueOnAnyThread(), 4, 24);
+	Quantization.NormalBits = FMath::Clamp(CVarNormalBits.GetValueOnAnyThread(), 4, 15);
+
+	return Quantization;
+}
+
+int32 SkullyMovementStateCodec::GetKeyframeInterval()
+{
+	return FMath::Max(CVarKeyframeInterval.GetValueOnAnyThread(), 1);
+}
+
+uint32 SkullyMovementStateCodec::EncodeNormal(const FVector& Normal, int32 Bits)
+{
+	const FVector N = Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+
+	// 팔면체에 투영한 뒤, 아래쪽 반구는 바깥 삼각형으로 접음
+	const double L1 = FMath::Abs(N.X) + FMath::Abs(N.Y) + FMath::Abs(N.Z);
+	double X = N.X / L1;
+	double Y = N.Y / L1;
+	if (N.Z < 0.0)
+	{
+		const double FoldedX = (1.0 - FMath::Abs(Y)) * (X >= 0.0 ? 1.0 : -1.0);
+		const double FoldedY = (1.0 - FMath::Abs(X)) * (Y >= 0.0 ? 1.0 : -1.0);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	const uint32 MaxValue = (1u << Bits) - 1;
+	const uint32 QX = static_cast<uint32>(FMath::Clamp<int64>(FMath::RoundToInt64((X * 0.5 + 0.5) * MaxValue), 0, MaxValue));
+	const uint32 QY = static_cast<uint32>(FMath::Clamp<int64>(FMath::RoundToInt64((Y * 0.5 + 0.5) * MaxValue), 0, MaxValue));
+
+	return QX | (QY << Bits);
+}
+
+FVector SkullyMovementStateCodec::DecodeNormal(uint32 Encoded, int32 Bits)
+{
+	const uint32 MaxValue = (1u << Bits) - 1;
+	double X = static_cast<double>(Encoded & MaxValue) / MaxValue * 2.0 - 1.0;
+	double Y = static_cast<double>((Encoded >> Bits) & MaxValue) / MaxValue * 2.0 - 1.0;
+	const double Z = 1.0 - FMath::Abs(X) - FMath::Abs(Y);
+	if (Z < 0.0)
+	{
+		const double UnfoldedX = (1.0 - FMath::Abs(Y)) * (X >= 0.0 ? 1.0 : -1.0);
+		const double UnfoldedY = (1.0 - FMath::Abs(X)) * (Y >= 0.0 ? 1.0 : -1.0);
+		X = UnfoldedX;
+		Y = UnfoldedY;
+	}
+
+	return FVector(X, Y, Z).GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+}
+
+void SkullyMovementStateCodec::Write(FArchive& Ar, const FSkullyMovementSnapshot& State, const FSkullyMovementSnapshot* Base, const FSkullyMovementStateQuantization& Quantization)
+{
+	const int32 VelocityBits = FMath::Clamp(Quantization.VelocityBits, 4, 24);
+	const int32 NormalBits = FMath::Clamp(Quantization.NormalBits, 4, 15);
+
+	uint32 VelocityQ[3];
+	bool bVelocityZero = true;
+	bool bVelocitySame = Base != nullptr;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		VelocityQ[Axis] = QuantizeSigned(State.Velocity[Axis], VelocityBits);
+		bVelocityZero &= VelocityQ[Axis] == QuantizeSigned(0.0, VelocityBits);
+		bVelocitySame &= Base != nullptr && VelocityQ[Axis] == QuantizeSigned(Base->Velocity[Axis], VelocityBits);
+	}
+
+	const uint32 CachedNormalQ = EncodeNormal(State.CachedFloorNormal, NormalBits);
+	const uint32 LastNormalQ = EncodeNormal(State.LastFloorNormal, NormalBits);
+	const bool bNormalsUp = State.CachedFloorNormal.Equals(FVector::UpVector) && State.LastFloorNormal.Equals(FVector::UpVector);
+	const bool bNormalsSame = Base != nullptr &&
+		CachedNormalQ == EncodeNormal(Base->CachedFloorNormal, NormalBits) &&
+		LastNormalQ == EncodeNormal(Base->LastFloorNormal, NormalBits);
+
+	const bool bLocationSame = Base != nullptr &&
+		QuantizeCm(State.Location.X) == QuantizeCm(Base->Location.X) &&
+		QuantizeCm(State.Location.Y) == QuantizeCm(Base->Location.Y) &&
+		QuantizeCm(State.Location.Z) == QuantizeCm(Base->Location.Z);
+
+	const uint32 AccumulatorQ = static_cast<uint32>(FMath::Clamp(FMath::RoundToInt(State.TimeAccumulator * SkullyNet::DeltaTimeQuantizeScale), 0, 65535));
+
+	uint32 Flags = 0;
+	Flags |= State.MovementMode == 0 ? Flag_Grounded : 0;
+	Flags |= State.bIsSlopeSliding ? Flag_Sliding : 0;
+	Flags |= bVelocityZero ? Flag_VelocityZero : 0;
+	Flags |= (bVelocityZero == false && bVelocitySame == true) ? Flag_VelocitySame : 0;
+	Flags |= bNormalsUp ? Flag_NormalsUp : 0;
+	Flags |= CachedNormalQ == LastNormalQ ? Flag_LastEqualsCached : 0;
+	Flags |= (bNormalsUp == false && bNormalsSame == true) ? Flag_NormalsSame : 0;
+	Flags |= (State.LastInputX != 0 || State.LastInputY != 0) ? Flag_HasInput : 0;
+	Flags |= AccumulatorQ != 0 ? Flag_HasAccumulator : 0;
+	Flags |= bLocationSame ? Flag_LocationSame : 0;
+	SerializeFixedBits(Ar, Flags, NumFlagBits);
+
+	// 위치
+	if (Base != nullptr)
+	{
+		if (bLocationSame == false)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				uint32 Packed = ZigZag(static_cast<int32>(QuantizeCm(State.Location[Axis]) - QuantizeCm(Base->Location[Axis])));
+				Ar.SerializeIntPacked(Packed);
+			}
+		}
+	}
+	else
+	{
+		FVector Location = State.Location;
+		SerializePackedVector<100, 30>(Location, Ar);
+	}
+
+	// 속도
+	if ((Flags & (Flag_VelocityZero | Flag_VelocitySame)) == 0)
+	{
+		uint32 Bits = VelocityBits;
+		SerializeFixedBits(Ar, Bits, 5);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			SerializeFixedBits(Ar, VelocityQ[Axis], VelocityBits);
+		}
+	}
+
+	// 바닥 노멀
+	if ((Flags & (Flag_NormalsUp | Flag_NormalsSame)) == 0)
+	{
+		uint32 Bits = NormalBits;
+		SerializeFixedBits(Ar, Bits, 4);
+
+		uint32 Cached = CachedNormalQ;
+		SerializeFixedBits(Ar, Cached, NormalBits * 2);
+		if ((Flags & Flag_LastEqualsCached) == 0)
+		{
+			uint32 Last = LastNormalQ;
+			SerializeFixedBits(Ar, Last, NormalBits * 2);
+		}
+	}
+
+	if ((Flags & Flag_HasInput) != 0)
+	{
+		uint32 InputX = static_cast<uint8>(State.LastInputX);
+		uint32 InputY = static_cast<uint8>(State.LastInputY);
+		SerializeFixedBits(Ar, InputX, 8);
+		SerializeFixedBits(Ar, InputY, 8);
+	}
+
+	if ((Flags & Flag_HasAccumulator) != 0)
+	{
+		uint32 Accumulator = AccumulatorQ;
+		SerializeFixedBits(Ar, Accumulator, 16);
+	}
+}
+
+bool SkullyMovementStateCodec::Read(FArchive& Ar, FSkullyMovementSnapshot& OutState, const FSkullyMovementSnapshot* Base)
+{
+	uint32 Flags = 0;
+	SerializeFixedBits(Ar, Flags, NumFlagBits);
+
+	// 기준 상태가 필요한 플래그인데 기준 상태가 없음
+	if (Base == nullptr && (Flags & (Flag_VelocitySame | Flag_NormalsSame | Flag_LocationSame)) != 0)
+	{
+		Ar.SetError();
+		return false;
+	}
+
+	OutState.MovementMode = (Flags & Flag_Grounded) != 0 ? 0 : 1;
+	OutState.bIsSlopeSliding = (Flags & Flag_Sliding) != 0;
+
+	// 위치
+	if (Base != nullptr)
+	{
+		if ((Flags & Flag_LocationSame) != 0)
+		{
+			OutState.Location = Base->Location;
+		}
+		else
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				uint32 Packed = 0;
+				Ar.SerializeIntPacked(Packed);
+				OutState.Location[Axis] = (QuantizeCm(Base->Location[Axis]) + UnZigZag(Packed)) / 100.0;
+			}
+		}
+	}
+	else
+	{
+		SerializePackedVector<100, 30>(OutState.Location, Ar);
+	}
+
+	// 속도
+	if ((Flags & Flag_VelocityZero) != 0)
+	{
+		OutState.Velocity = FVector::ZeroVector;
+	}
+	else if ((Flags & Flag_VelocitySame) != 0)
+	{
+		OutState.Velocity = Base->Velocity;
+	}
+	else
+	{
+		uint32 Bits = 0;
+		SerializeFixedBits(Ar, Bits, 5);
+		if (Bits < 4)
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			uint32 Quantized = 0;
+			SerializeFixedBits(Ar, Quantized, Bits);
+			OutState.Velocity[Axis] = DequantizeSigned(Quantized, Bits);
+		}
+	}
+
+	// 바닥 노멀
+	if ((Flags & Flag_NormalsUp) != 0)
+	{
+		OutState.CachedFloorNormal = FVector::UpVector;
+		OutState.LastFloorNormal = FVector::UpVector;
+	}
+	else if ((Flags & Flag_NormalsSame) != 0)
+	{
+		OutState.CachedFloorNormal = Base->CachedFloorNormal;
+		OutState.LastFloorNormal = Base->LastFloorNormal;
+	}
+	else
+	{
+		uint32 Bits = 0;
+		SerializeFixedBits(Ar, Bits, 4);
+		if (Bits < 4)
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		uint32 Cached = 0;
+		SerializeFixedBits(Ar, Cached, Bits * 2);
+		OutState.CachedFloorNormal = DecodeNormal(Cached, Bits);
+
+		if ((Flags & Flag_LastEqualsCached) != 0)
+		{
+			OutState.LastFloorNormal = OutState.CachedFloorNormal;
+		}
+		else
+		{
+			uint32 Last = 0;
+			SerializeFixedBits(Ar, Last, Bits * 2);
+			OutState.LastFloorNormal = DecodeNormal(Last, Bits);
+		}
+	}
+
+	OutState.LastInputX = 0;
+	OutState.LastInputY = 0;
+	if ((Flags & Flag_HasInput) != 0)
+	{
+		uint32 InputX = 0;
+		uint32 InputY = 0;
+		SerializeFixedBits(Ar, InputX, 8);
+		SerializeFixedBits(Ar, InputY, 8);
+		OutState.LastInputX = static_cast<int8>(static_cast<uint8>(InputX));
+		OutState.LastInputY = static_cast<int8>(static_cast<uint8>(InputY));
+	}
+
+	OutState.TimeAccumulator = 0.0f;
+	if ((Flags & Flag_HasAccumulator) != 0)
+	{
+		uint32 Accumulator = 0;
+		SerializeFixedBits(Ar, Accumulator, 16);
+		OutState.TimeAccumulator = Accumulator / SkullyNet::DeltaTimeQuantizeScale;
+	}
+
+	return Ar.IsError() == false;
+}
+
+int64 SkullyMovementStateCodec::GetPackedBits(const FSkullyMovementSnapshot& State, const FSkullyMovementSnapshot* Base, const FSkullyMovementStateQuantization& Quantization)
+{
+	FBitWriter Writer(0, true);
+	Write(Writer, State, Base, Quantization);
+
+	return Writer.GetNumBits();
+}
+
+bool SkullyMovementStateCodec::Pack(FSkullyPackedMovementState& OutPacked, const FSkullyMovementSnapshot& State, const FSkullyMovementSnapshot* Base, uint16 BaseSequence, FSkullyMovementSnapshot& OutQuantizedState)
+{
+	// 위치 차이가 너무 크면(순간이동 등) 키프레임으로 보냄
+	if (Base != nullptr && (BaseSequence == 0 || IsLocationDeltaEncodable(State.Location, Base->Location) == false))
+	{
+		Base = nullptr;
+	}
+
+	FBitWriter Writer(0, true);
+	Write(Writer, State, Base, GetQuantization());
+
+	OutPacked.BaseSequence = Base != nullptr ? BaseSequence : 0;
+	OutPacked.NumBits = static_cast<uint32>(Writer.GetNumBits());
+	OutPacked.Data = *Writer.GetBuffer();
+
+	return Unpack(OutPacked, Base, OutQuantizedState);
+}
+
+bool SkullyMovementStateCodec::Unpack(const FSkullyPackedMovementState& Packed, const FSkullyMovementSnapshot* Base, FSkullyMovementSnapshot& OutState)
+{
+	if (Packed.BaseSequence != 0 && Base == nullptr)
+	{
+		return false;
+	}
+
+	FBitReader Reader(const_cast<uint8*>(Packed.Data.GetData()), Packed.NumBits);
+	return Read(Reader, OutState, Packed.BaseSequence != 0 ? Base : nullptr);
+}
+
+bool FSkullyMovementSnapshot::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	if (Ar.IsSaving() == true)
+	{
+		SkullyMovementStateCodec::Write(Ar, *this, nullptr, SkullyMovementStateCodec::GetQuantization());
+		bOutSuccess = true;
+	}
+	else
+	{
+		bOutSuccess = SkullyMovementStateCodec::Read(Ar, *this, nullptr);
+	}
+
+	return true;
+}
+
+bool FSkullyPackedMovementState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// 보정 상태 하나는 수백 비트 이내, 비정상적인 길이는 거부
+	constexpr uint32 MaxBits = 2048;
+
+	Ar << BaseSequence;
+	Ar.SerializeIntPacked(NumBits);
+
+	if (NumBits > MaxBits)
+	{
+		Ar.SetError();
+		bOutSuccess = false;
+		return true;
+	}
+
+	if (Ar.IsLoading() == true)
+	{
+		Data.SetNumZeroed((NumBits + 7) / 8);
+	}
+	else if (Data.Num() * 8 < static_cast<int32>(NumBits))
+	{
+		Ar.SetError();
+		bOutSuccess = false;
+		return true;
+	}
+
+	Ar.SerializeBits(Data.GetData(), NumBits);
+
+	bOutSuccess = Ar.IsError() == false;
+	return true;
+}
+
+void FSkullyMovementStateHistory::Add(uint16 Sequence, const FSkullyMovementSnapshot& State)
+{
+	const int32 Index = Sequence % Capacity;
+	States[Index] = State;
+	Sequences[Index] = Sequence;
+	bValid[Index] = true;
+}
+
+const FSkullyMovementSnapshot* FSkullyMovementStateHistory::Find(uint16 Sequence) const
+{
+	const int32 Index = Sequence % Capacity;
+	return bValid[Index] == true && Sequences[Index] == Sequence ? &States[Index] : nullptr;
+}
+
+void FSkullyMovementStateHistory::Reset()
+{
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		bValid[Index] = false;
+	}
+}
@@ -0,0 +1,87 @@
+/*
+ * 파일명: SkullyMovementStats.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 관련 stat 그룹/카운터(stat SkullyMovement)와 Unreal Insights 트레이스 채널(SkullyMovementChannel)
+ */
+
+#include "Skully/SkullyMovementStats.h"
+
+#include "ProfilingDebugging/MiscTrace.h"
+
+DEFINE_STAT(STAT_SkullyMovementTick);
+DEFINE_STAT(STAT_SkullyApplyGravity);
+DEFINE_STAT(STAT_SkullyApplySlopeSlide);
+DEFINE_STAT(STAT_SkullyApplyFriction);
+DEFINE_STAT(STAT_SkullyMove);
+DEFINE_STAT(STAT_SkullyCheckGround);
+DEFINE_STAT(STAT_SkullySnapToGround);
+DEFINE_STAT(STAT_SkullyBodyBatchStep);
+
+DEFINE_STAT(STAT_SkullySimulationSteps);
+DEFINE_STAT(STAT_SkullyMoveSweeps);
+DEFINE_STAT(STAT_SkullyMoveIterations);
+DEFINE_STAT(STAT_SkullyMoveIterationLimitHits);
+DEFINE_STAT(STAT_SkullyMoveDepenetrations);
+DEFINE_STAT(STAT_SkullyGroundSweeps);
+DEFINE_STAT(STAT_SkullyGroundSweepsReusedOnBase);
+DEFINE_STAT(STAT_SkullyGroundSweepsFromField);
+DEFINE_STAT(STAT_SkullyGroundLineTraces);
+DEFINE_STAT(STAT_SkullySlideAlongSurface);
+DEFINE_STAT(STAT_SkullyFloorReprojections);
+DEFINE_STAT(STAT_SkullyBatchBodySteps);
+
+DEFINE_STAT(STAT_SkullyNetMovesSent);
+DEFINE_STAT(STAT_SkullyNetMoveBytes);
+DEFINE_STAT(STAT_SkullyNetCorrections);
+DEFINE_STAT(STAT_SkullyNetReplayedMoves);
+DEFINE_STAT(STAT_SkullyNetStateBytes);
+
+DEFINE_STAT(STAT_SkullySleepingBodies);
+
+DEFINE_STAT(STAT_SkullyGroundProbeSimple);
+DEFINE_STAT(STAT_SkullyGroundProbeComplex);
+DEFINE_STAT(STAT_SkullyGroundProbeComplexFallback);
+
+DEFINE_STAT(STAT_SkullyCameraProbesSync);
+DEFINE_STAT(STAT_SkullyCameraProbesAsync);
+DEFINE_STAT(STAT_SkullyCameraProbesSkipped);
+
+DEFINE_STAT(STAT_SkullyGimmickCellCrossings);
+DEFINE_STAT(STAT_SkullyGimmickEvaluations);
+
+DEFINE_STAT(STAT_SkullyVisualTransformUpdates);
+DEFINE_STAT(STAT_SkullyVisualTransformUpdatesSaved);
+
+UE_TRACE_CHANNEL_DEFINE(SkullyMovementChannel);
+
+UE_TRACE_EVENT_BEGIN(SkullyMovement, ModeTransition)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, SourceId)
+	UE_TRACE_EVENT_FIELD(uint8, Event)
+	UE_TRACE_EVENT_FIELD(float, X)
+	UE_TRACE_EVENT_FIELD(float, Y)
+	UE_TRACE_EVENT_FIELD(float, Z)
+	UE_TRACE_EVENT_FIELD(float, Speed)
+UE_TRACE_EVENT_END()
+
+void SkullyTraceMovementEvent(const UObject* Source, ESkullyMovementTraceEvent Event, const FVector& Location, float Speed)
+{
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(SkullyMovementChannel) == false)
+	{
+		return;
+	}
+	
+	UE_TRACE_LOG(SkullyMovement, ModeTransition, SkullyMovementChannel)
+		<< ModeTransition.Cycle(FPlatformTime::Cycles64())
+		<< ModeTransition.SourceId(Source != nullptr ? Source->GetUniqueID() : 0)
+		<< ModeTransition.Event(static_cast<uint8>(Event))
+		<< ModeTransition.X(static_cast<float>(Location.X))
+		<< ModeTransition.Y(static_cast<float>(Location.Y))
+		<< ModeTransition.Z(static_cast<float>(Location.Z))
+		<< ModeTransition.Speed(Speed);
+	
+	// 타이밍 뷰에서 바로 보이도록 북마크도 남김
+	static const TCHAR* EventNames[] = { TEXT("Landed"), TEXT("StartedFalling"), TEXT("SlideStarted"), TEXT("SlideStopped"), TEXT("Slept"), TEXT("Woke") };
+	TRACE_BOOKMARK(TEXT("Skully %s"), EventNames[static_cast<uint8>(Event)]);
+}
@@ -0,0 +1,71 @@
+/*
+ * 파일명: SkullyMovingPlatform.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 왕복 이동 + 회전하는 움직이는 발판(움직이는 바닥 추적 테스트/벤치마크용)
+ */
+
+#include "Skully/SkullyMovingPlatform.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "Skully/SkullyWalkabilitySubsystem.h"
+
+ASkullyMovingPlatform::ASkullyMovingPlatform()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	PlatformMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("PlatformMesh"));
+	RootComponent = PlatformMesh;
+	PlatformMesh->SetMobility(EComponentMobility::Movable);
+	PlatformMesh->SetCollisionProfileName(TEXT("BlockAll"));
+
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> CubeMesh(TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (CubeMesh.Succeeded() == true)
+	{
+		PlatformMesh->SetStaticMesh(CubeMesh.Object);
+		PlatformMesh->SetRelativeScale3D(FVector(6.0f, 6.0f, 0.5f));
+	}
+}
+
+void ASkullyMovingPlatform::BeginPlay()
+{
+	Super::BeginPlay();
+
+	StartLocation = GetActorLocation();
+	StartRotation = GetActorRotation();
+	ElapsedTime = 0.0f;
+
+	// 구워진 바닥 격자 위를 지나가므로, 겹치는 셀은 격자 대신 씬 쿼리로 감지하도록 등록
+	if (USkullyWalkabilitySubsystem* Walkability = GetWorld()->GetSubsystem<USkullyWalkabilitySubsystem>())
+	{
+		Walkability->RegisterDynamicPrimitive(PlatformMesh);
+	}
+}
+
+void ASkullyMovingPlatform::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USkullyWalkabilitySubsystem* Walkability = GetWorld()->GetSubsystem<USkullyWalkabilitySubsystem>())
+	{
+		Walkability->UnregisterDynamicPrimitive(PlatformMesh);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASkullyMovingPlatform::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ElapsedTime += DeltaTime;
+	UpdatePlatform(ElapsedTime);
+}
+
+void ASkullyMovingPlatform::UpdatePlatform(float Time)
+{
+	// 0 -> 1 -> 0으로 부드럽게 왕복
+	const float Alpha = 0.5f - 0.5f * FMath::Cos((Time + TimeOffset) * UE_TWO_PI / MovePeriod);
+	const FRotator Rotation = StartRotation + RotationRate * Time;
+
+	SetActorLocationAndRotation(StartLocation + MoveOffset * Alpha, Rotation);
+}
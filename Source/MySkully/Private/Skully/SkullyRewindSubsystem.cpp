@@ -0,0 +1,575 @@
+/*
+ * 파일명: SkullyRewindSubsystem.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 상태와 기믹 상태를 링 버퍼에 델타 인코딩으로 기록하고 되감기/체크포인트 복원하는 월드 서브시스템
+ */
+
+#include "Skully/SkullyRewindSubsystem.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "MySkully.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Skully/SkullyGimmick.h"
+#include "Skully/SkullyMovementComponent.h"
+#include "Skully/SkullyMovementStateCodec.h"
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarRewindEnable(
+		TEXT("Skully.Rewind.Enable"),
+		true,
+		TEXT("되감기용 상태 기록 여부"));
+
+	TAutoConsoleVariable<float> CVarRewindRecordRate(
+		TEXT("Skully.Rewind.RecordRate"),
+		30.0f,
+		TEXT("초당 기록 프레임 수"));
+
+	TAutoConsoleVariable<int32> CVarRewindKeyframeInterval(
+		TEXT("Skully.Rewind.KeyframeInterval"),
+		30,
+		TEXT("키프레임 간격(프레임), 늘리면 기록이 작아지지만 되감을 때 디코드할 프레임이 늘어남"));
+
+	TAutoConsoleVariable<int32> CVarRewindArenaKB(
+		TEXT("Skully.Rewind.ArenaKB"),
+		512,
+		TEXT("기록 아레나 크기(KB, 월드 생성 시 할당)"));
+
+	TAutoConsoleVariable<int32> CVarRewindMaxFrames(
+		TEXT("Skully.Rewind.MaxFrames"),
+		1800,
+		TEXT("링에 보관하는 최대 프레임 수(월드 생성 시 할당)"));
+
+	// 손상된 기록을 읽을 때 대상 수 상한
+	constexpr uint32 MaxSubjectsPerFrame = 4096;
+}
+
+void USkullyRewindSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	
+	// 기록 중에는 할당하지 않도록 아레나와 프레임 링을 미리 할당
+	Arena.SetNumZeroed(FMath::Max(CVarRewindArenaKB.GetValueOnGameThread(), 1) * 1024);
+	Frames.SetNum(FMath::Max(CVarRewindMaxFrames.GetValueOnGameThread(), 2));
+	ClearFrames();
+}
+
+void USkullyRewindSubsystem::Deinitialize()
+{
+	Arena.Empty();
+	Frames.Empty();
+	NumFrames = 0;
+	Bodies.Empty();
+	Gimmicks.Empty();
+	Checkpoints.Empty();
+	EncoderState = FDecodeState();
+	
+	Super::Deinitialize();
+}
+
+TStatId USkullyRewindSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkullyRewindSubsystem, STATGROUP_Tickables);
+}
+
+void USkullyRewindSubsystem::RegisterBody(USkullyMovementComponent* Body)
+{
+	for (const TPair<uint32, TWeakObjectPtr<USkullyMovementComponent>>& Pair : Bodies)
+	{
+		if (Pair.Value.Get() == Body)
+		{
+			return;
+		}
+	}
+	
+	Bodies.Add(NextSubjectId++, Body);
+}
+
+void USkullyRewindSubsystem::UnregisterBody(USkullyMovementComponent* Body)
+{
+	for (auto It = Bodies.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Get() == Body)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void USkullyRewindSubsystem::RegisterGimmick(ASkullyGimmick* Gimmick)
+{
+	for (const TPair<uint32, TWeakObjectPtr<ASkullyGimmick>>& Pair : Gimmicks)
+	{
+		if (Pair.Value.Get() == Gimmick)
+		{
+			return;
+		}
+	}
+	
+	Gimmicks.Add(NextSubjectId++, Gimmick);
+}
+
+void USkullyRewindSubsystem::UnregisterGimmick(ASkullyGimmick* Gimmick)
+{
+	for (auto It = Gimmicks.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Get() == Gimmick)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void USkullyRewindSubsystem::Tick(float DeltaTime)
+{
+	if (CVarRewindEnable.GetValueOnGameThread() == false || (Bodies.Num() == 0 && Gimmicks.Num() == 0))
+	{
+		return;
+	}
+	
+	RecordClock += DeltaTime;
+	RecordAccumulator += DeltaTime;
+	
+	const float RecordInterval = 1.0f / FMath::Max(CVarRewindRecordRate.GetValueOnGameThread(), 1.0f);
+	if (RecordAccumulator < RecordInterval)
+	{
+		return;
+	}
+	
+	RecordAccumulator = FMath::Fmod(RecordAccumulator, RecordInterval);
+	RecordFrame();
+}
+
+void USkullyRewindSubsystem::RecordFrame()
+{
+	const bool bKeyframe = NumFrames == 0 || FramesSinceKeyframe >= FMath::Max(CVarRewindKeyframeInterval.GetValueOnGameThread(), 1);
+	
+	FBitWriter Writer(0, true);
+	EncodeFrame(Writer, bKeyframe, EncoderState);
+	
+	if (PushFrame(Writer.GetData(), static_cast<int32>(Writer.GetNumBytes()), Writer.GetNumBits(), bKeyframe) == false)
+	{
+		return;
+	}
+	
+	// 인코더 기준 상태는 디코더가 보게 될 값(양자화된 값)으로 유지
+	TArray<uint32> BodyIds;
+	TArray<uint32> GimmickIds;
+	DecodeFrame(Writer.GetData(), Writer.GetNumBits(), EncoderState, BodyIds, GimmickIds);
+	
+	FramesSinceKeyframe = bKeyframe == true ? 1 : FramesSinceKeyframe + 1;
+}
+
+void USkullyRewindSubsystem::EncodeFrame(FBitWriter& Writer, bool bKeyframe, const FDecodeState& Bases)
+{
+	const FSkullyMovementStateQuantization Quantization = SkullyMovementStateCodec::GetQuantization();
+	
+	Writer.WriteBit(bKeyframe == true ? 1 : 0);
+	
+	// 몸체: 코덱 델타(기준이 없거나 위치 차이가 너무 크면 키 상태)
+	uint32 NumBodies = 0;
+	for (const TPair<uint32, TWeakObjectPtr<USkullyMovementComponent>>& Pair : Bodies)
+	{
+		NumBodies += Pair.Value.IsValid() == true ? 1 : 0;
+	}
+	Writer.SerializeIntPacked(NumBodies);
+	
+	for (const TPair<uint32, TWeakObjectPtr<USkullyMovementComponent>>& Pair : Bodies)
+	{
+		if (Pair.Value.IsValid() == false)
+		{
+			continue;
+		}
+		
+		uint32 Id = Pair.Key;
+		Writer.SerializeIntPacked(Id);
+		
+		const FSkullyMovementSnapshot State = Pair.Value->CaptureSnapshot();
+		const FSkullyMovementSnapshot* Base = bKeyframe == false ? Bases.Bodies.Find(Id) : nullptr;
+		if (Base != nullptr && SkullyMovementStateCodec::IsLocationDeltaEncodable(State.Location, Base->Location) == false)
+		{
+			Base = nullptr;
+		}
+		
+		Writer.WriteBit(Base != nullptr ? 1 : 0);
+		SkullyMovementStateCodec::Write(Writer, State, Base, Quantization);
+	}
+	
+	// 기믹: 직전 기록과 같으면 1비트, 다르면 바이트 전체
+	uint32 NumGimmicks = 0;
+	for (const TPair<uint32, TWeakObjectPtr<ASkullyGimmick>>& Pair : Gimmicks)
+	{
+		NumGimmicks += Pair.Value.IsValid() == true ? 1 : 0;
+	}
+	Writer.SerializeIntPacked(NumGimmicks);
+	
+	for (const TPair<uint32, TWeakObjectPtr<ASkullyGimmick>>& Pair : Gimmicks)
+	{
+		if (Pair.Value.IsValid() == false)
+		{
+			continue;
+		}
+		
+		uint32 Id = Pair.Key;
+		Writer.SerializeIntPacked(Id);
+		
+		GimmickScratch.Reset();
+		FMemoryWriter GimmickWriter(GimmickScratch);
+		Pair.Value->SerializeRewindState(GimmickWriter);
+		
+		const TArray<uint8>* Base = bKeyframe == false ? Bases.Gimmicks.Find(Id) : nullptr;
+		const bool bSame = Base != nullptr && *Base == GimmickScratch;
+		Writer.WriteBit(bSame == true ? 1 : 0);
+		
+		if (bSame == false)
+		{
+			uint32 NumBytes = GimmickScratch.Num();
+			Writer.SerializeIntPacked(NumBytes);
+			Writer.Serialize(GimmickScratch.GetData(), NumBytes);
+		}
+	}
+}
+
+bool USkullyRewindSubsystem::DecodeFrame(const uint8* Data, int64 NumBits, FDecodeState& State, TArray<uint32>& OutBodyIds, TArray<uint32>& OutGimmickIds) const
+{
+	FBitReader Reader(const_cast<uint8*>(Data), NumBits);
+	
+	const bool bKeyframe = Reader.ReadBit() != 0;
+	if (bKeyframe == true)
+	{
+		State.Bodies.Reset();
+		State.Gimmicks.Reset();
+	}
+	
+	uint32 NumBodies = 0;
+	Reader.SerializeIntPacked(NumBodies);
+	if (NumBodies > MaxSubjectsPerFrame)
+	{
+		return false;
+	}
+	
+	for (uint32 Index = 0; Index < NumBodies; ++Index)
+	{
+		uint32 Id = 0;
+		Reader.SerializeIntPacked(Id);
+		const bool bDelta = Reader.ReadBit() != 0;
+		
+		const FSkullyMovementSnapshot* Base = bDelta == true ? State.Bodies.Find(Id) : nullptr;
+		if (bDelta == true && Base == nullptr)
+		{
+			return false;
+		}
+		
+		FSkullyMovementSnapshot Decoded;
+		if (SkullyMovementStateCodec::Read(Reader, Decoded, Base) == false)
+		{
+			return false;
+		}
+		
+		State.Bodies.Add(Id, Decoded);
+		OutBodyIds.Add(Id);
+	}
+	
+	uint32 NumGimmicks = 0;
+	Reader.SerializeIntPacked(NumGimmicks);
+	if (NumGimmicks > MaxSubjectsPerFrame)
+	{
+		return false;
+	}
+	
+	for (uint32 Index = 0; Index < NumGimmicks; ++Index)
+	{
+		uint32 Id = 0;
+		Reader.SerializeIntPacked(Id);
+		const bool bSame = Reader.ReadBit() != 0;
+		
+		if (bSame == true)
+		{
+			if (State.Gimmicks.Contains(Id) == false)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			uint32 NumBytes = 0;
+			Reader.SerializeIntPacked(NumBytes);
+			if (static_cast<int64>(NumBytes) * 8 > Reader.GetBitsLeft())
+			{
+				return false;
+			}
+			
+			TArray<uint8>& Bytes = State.Gimmicks.FindOrAdd(Id);
+			Bytes.SetNumUninitialized(NumBytes);
+			Reader.Serialize(Bytes.GetData(), NumBytes);
+		}
+		
+		OutGimmickIds.Add(Id);
+	}
+	
+	return Reader.IsError() == false;
+}
+
+void USkullyRewindSubsystem::ApplyState(const FDecodeState& State, const TArray<uint32>& BodyIds, const TArray<uint32>& GimmickIds)
+{
+	for (const uint32 Id : BodyIds)
+	{
+		const TWeakObjectPtr<USkullyMovementComponent>* Body = Bodies.Find(Id);
+		const FSkullyMovementSnapshot* Snapshot = State.Bodies.Find(Id);
+		if (Body != nullptr && Body->IsValid() == true && Snapshot != nullptr)
+		{
+			(*Body)->RestoreSnapshot(*Snapshot);
+		}
+	}
+	
+	for (const uint32 Id : GimmickIds)
+	{
+		const TWeakObjectPtr<ASkullyGimmick>* Gimmick = Gimmicks.Find(Id);
+		const TArray<uint8>* Bytes = State.Gimmicks.Find(Id);
+		if (Gimmick != nullptr && Gimmick->IsValid() == true && Bytes != nullptr)
+		{
+			FMemoryReader GimmickReader(*Bytes);
+			(*Gimmick)->SerializeRewindState(GimmickReader);
+		}
+	}
+}
+
+bool USkullyRewindSubsystem::PushFrame(const uint8* Data, int32 NumBytes, int64 NumBits, bool bKeyframe)
+{
+	if (NumBytes > Arena.Num())
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Rewind] 프레임(%d바이트)이 아레나(%d바이트)보다 큼, Skully.Rewind.ArenaKB를 늘리세요"), NumBytes, Arena.Num());
+		return false;
+	}
+	
+	// 자리가 날 때까지 가장 오래된 프레임부터 버림
+	while (NumFrames > 0 && (ArenaUsedBytes + NumBytes > Arena.Num() || NumFrames == Frames.Num()))
+	{
+		PopOldestFrame();
+	}
+	
+	// 원형 아레나에 복사(끝을 넘으면 앞으로 이어서)
+	const int32 FirstPart = FMath::Min(NumBytes, Arena.Num() - ArenaWriteOffset);
+	FMemory::Memcpy(Arena.GetData() + ArenaWriteOffset, Data, FirstPart);
+	if (FirstPart < NumBytes)
+	{
+		FMemory::Memcpy(Arena.GetData(), Data + FirstPart, NumBytes - FirstPart);
+	}
+	
+	FFrameRecord& Record = GetFrame(NumFrames);
+	Record.Time = RecordClock;
+	Record.Offset = ArenaWriteOffset;
+	Record.NumBytes = NumBytes;
+	Record.NumBits = NumBits;
+	Record.bKeyframe = bKeyframe;
+	
+	ArenaWriteOffset = (ArenaWriteOffset + NumBytes) % Arena.Num();
+	ArenaUsedBytes += NumBytes;
+	++NumFrames;
+	
+	// 맨 앞 프레임이 키프레임이 아니면 디코드할 수 없으므로 다음 키프레임까지 버림
+	while (NumFrames > 0 && GetFrame(0).bKeyframe == false)
+	{
+		PopOldestFrame();
+	}
+	
+	return true;
+}
+
+const uint8* USkullyRewindSubsystem::GetFrameData(const FFrameRecord& Record, TArray<uint8>& Scratch) const
+{
+	if (Record.Offset + Record.NumBytes <= Arena.Num())
+	{
+		return Arena.GetData() + Record.Offset;
+	}
+	
+	// 아레나 끝에서 잘린 프레임은 이어 붙여서 읽음
+	const int32 FirstPart = Arena.Num() - Record.Offset;
+	Scratch.SetNumUninitialized(Record.NumBytes);
+	FMemory::Memcpy(Scratch.GetData(), Arena.GetData() + Record.Offset, FirstPart);
+	FMemory::Memcpy(Scratch.GetData() + FirstPart, Arena.GetData(), Record.NumBytes - FirstPart);
+	
+	return Scratch.GetData();
+}
+
+void USkullyRewindSubsystem::PopOldestFrame()
+{
+	ArenaUsedBytes -= GetFrame(0).NumBytes;
+	FirstFrame = (FirstFrame + 1) % Frames.Num();
+	--NumFrames;
+}
+
+void USkullyRewindSubsystem::ClearFrames()
+{
+	ArenaWriteOffset = 0;
+	ArenaUsedBytes = 0;
+	FirstFrame = 0;
+	NumFrames = 0;
+	FramesSinceKeyframe = 0;
+	RecordAccumulator = 0.0f;
+}
+
+float USkullyRewindSubsystem::GetRecordedDuration() const
+{
+	return NumFrames > 0 ? static_cast<float>(RecordClock - GetFrame(0).Time) : 0.0f;
+}
+
+bool USkullyRewindSubsystem::RewindSeconds(float Seconds)
+{
+	if (NumFrames == 0)
+	{
+		return false;
+	}
+	
+	// 목표 시간 이전의 가장 최근 프레임
+	const double TargetTime = RecordClock - FMath::Max(Seconds, 0.0f);
+	int32 Index = NumFrames - 1;
+	while (Index > 0 && GetFrame(Index).Time > TargetTime)
+	{
+		--Index;
+	}
+	
+	return RestoreFrame(Index);
+}
+
+bool USkullyRewindSubsystem::RestoreFrame(int32 Index)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	
+	// 목표 프레임 이전의 키프레임부터 디코드(맨 앞 프레임은 항상 키프레임)
+	int32 KeyIndex = Index;
+	while (KeyIndex > 0 && GetFrame(KeyIndex).bKeyframe == false)
+	{
+		--KeyIndex;
+	}
+	
+	FDecodeState State;
+	TArray<uint32> BodyIds;
+	TArray<uint32> GimmickIds;
+	TArray<uint8> Scratch;
+	for (int32 FrameIndex = KeyIndex; FrameIndex <= Index; ++FrameIndex)
+	{
+		const FFrameRecord& Record = GetFrame(FrameIndex);
+		BodyIds.Reset();
+		GimmickIds.Reset();
+		if (DecodeFrame(GetFrameData(Record, Scratch), Record.NumBits, State, BodyIds, GimmickIds) == false)
+		{
+			UE_LOG(LogSkullyMovement, Warning, TEXT("[Rewind] 프레임 디코드 실패(%d), 기록을 비웁니다"), FrameIndex);
+			ClearFrames();
+			return false;
+		}
+	}
+	
+	ApplyState(State, BodyIds, GimmickIds);
+	
+	// 목표 프레임 이후 기록은 버리고 거기서부터 다시 기록
+	const FFrameRecord& Target = GetFrame(Index);
+	const double RewoundSeconds = RecordClock - Target.Time;
+	RecordClock = Target.Time;
+	ArenaWriteOffset = (Target.Offset + Target.NumBytes) % Arena.Num();
+	ArenaUsedBytes = 0;
+	for (int32 FrameIndex = 0; FrameIndex <= Index; ++FrameIndex)
+	{
+		ArenaUsedBytes += GetFrame(FrameIndex).NumBytes;
+	}
+	NumFrames = Index + 1;
+	FramesSinceKeyframe = Index - KeyIndex + 1;
+	RecordAccumulator = 0.0f;
+	EncoderState = MoveTemp(State);
+	
+	UE_LOG(LogSkullyMovement, Log, TEXT("[Rewind] %.2f초 되감기: 프레임 %d개 디코드, %.3f ms"),
+		RewoundSeconds, Index - KeyIndex + 1, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	
+	return true;
+}
+
+void USkullyRewindSubsystem::SaveCheckpoint(FName Name)
+{
+	FBitWriter Writer(0, true);
+	EncodeFrame(Writer, true, FDecodeState());
+	
+	FCheckpoint& Checkpoint = Checkpoints.FindOrAdd(Name);
+	Checkpoint.Data = TArray<uint8>(Writer.GetData(), static_cast<int32>(Writer.GetNumBytes()));
+	Checkpoint.NumBits = Writer.GetNumBits();
+	
+	UE_LOG(LogSkullyMovement, Log, TEXT("[Rewind] 체크포인트 저장 %s: %d바이트"), *Name.ToString(), Checkpoint.Data.Num());
+}
+
+bool USkullyRewindSubsystem::RestoreCheckpoint(FName Name)
+{
+	const FCheckpoint* Checkpoint = Checkpoints.Find(Name);
+	if (Checkpoint == nullptr)
+	{
+		return false;
+	}
+	
+	const double StartTime = FPlatformTime::Seconds();
+	
+	FDecodeState State;
+	TArray<uint32> BodyIds;
+	TArray<uint32> GimmickIds;
+	if (DecodeFrame(Checkpoint->Data.GetData(), Checkpoint->NumBits, State, BodyIds, GimmickIds) == false)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Rewind] 체크포인트 디코드 실패: %s"), *Name.ToString());
+		return false;
+	}
+	
+	ApplyState(State, BodyIds, GimmickIds);
+	
+	// 체크포인트 이후의 기록은 복원한 상태와 이어지지 않으므로 비움(다음 기록은 키프레임)
+	ClearFrames();
+	EncoderState = MoveTemp(State);
+	
+	UE_LOG(LogSkullyMovement, Log, TEXT("[Rewind] 체크포인트 복원 %s: %.3f ms"), *Name.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+	USkullyRewindSubsystem* GetRewindSubsystem(UWorld* World)
+	{
+		return World != nullptr ? World->GetSubsystem<USkullyRewindSubsystem>() : nullptr;
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs RewindCommand(
+		TEXT("Skully.Rewind"),
+		TEXT("기록된 상태로 되감기: Skully.Rewind [초=2]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (USkullyRewindSubsystem* Rewind = GetRewindSubsystem(World))
+			{
+				Rewind->RewindSeconds(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 2.0f);
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs SaveCheckpointCommand(
+		TEXT("Skully.Rewind.Save"),
+		TEXT("현재 상태를 체크포인트로 저장: Skully.Rewind.Save [이름=Default]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (USkullyRewindSubsystem* Rewind = GetRewindSubsystem(World))
+			{
+				Rewind->SaveCheckpoint(Args.Num() > 0 ? FName(*Args[0]) : FName(TEXT("Default")));
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs LoadCheckpointCommand(
+		TEXT("Skully.Rewind.Load"),
+		TEXT("체크포인트 복원: Skully.Rewind.Load [이름=Default]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (USkullyRewindSubsystem* Rewind = GetRewindSubsystem(World))
+			{
+				Rewind->RestoreCheckpoint(Args.Num() > 0 ? FName(*Args[0]) : FName(TEXT("Default")));
+			}
+		}));
+}
+
+#endif
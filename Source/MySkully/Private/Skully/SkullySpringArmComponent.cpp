@@ -0,0 +1,186 @@
+/*
+ * 파일명: SkullySpringArmComponent.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 카메라 충돌 프로브 빈도를 조절하는 Skully 전용 스프링 암
+ */
+
+#include "Skully/SkullySpringArmComponent.h"
+
+#include "Engine/World.h"
+#include "Skully/SkullyMovementStats.h"
+
+USkullySpringArmComponent::USkullySpringArmComponent()
+{
+	AsyncProbeDelegate.BindUObject(this, &USkullySpringArmComponent::OnAsyncProbeDone);
+}
+
+void USkullySpringArmComponent::InvalidateProbe()
+{
+	bHasProbeResult = false;
+	PendingProbeHandle.Invalidate();
+}
+
+void USkullySpringArmComponent::OnUnregister()
+{
+	// 등록 해제 후 도착하는 비동기 결과는 무시
+	InvalidateProbe();
+	SmoothedBlockedDistance = MAX_FLT;
+	
+	Super::OnUnregister();
+}
+
+void USkullySpringArmComponent::UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime)
+{
+	if (bDoTrace == false || TargetArmLength == 0.0f)
+	{
+		SmoothedBlockedDistance = MAX_FLT;
+		Super::UpdateDesiredArmLocation(bDoTrace, bDoLocationLag, bDoRotationLag, DeltaTime);
+		return;
+	}
+	
+	// 스윕 없이 래그/회전만 적용한 카메라 위치를 먼저 계산(소켓이 막히지 않은 위치로 갱신됨)
+	Super::UpdateDesiredArmLocation(false, bDoLocationLag, bDoRotationLag, DeltaTime);
+	
+	const FVector ArmOrigin = PreviousArmOrigin;
+	const FTransform DesiredCamTM = FTransform(RelativeSocketRotation, RelativeSocketLocation) * GetComponentTransform();
+	const FVector DesiredLoc = DesiredCamTM.GetLocation();
+	
+	if (NeedsProbe(ArmOrigin, DesiredLoc) == true)
+	{
+		// 첫 스윕(또는 InvalidateProbe 직후)은 보여줄 결과가 없으므로 동기로 처리
+		if (bUseAsyncProbe == true && bHasProbeResult == true)
+		{
+			ProbeAsync(ArmOrigin, DesiredLoc);
+		}
+		else
+		{
+			ProbeSync(ArmOrigin, DesiredLoc);
+		}
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_SkullyCameraProbesSkipped);
+	}
+	
+	// 막힌 거리 보간(당길 때/풀 때 속도 분리, DeltaTime이 0이면 즉시)
+	const FVector ToDesired = DesiredLoc - ArmOrigin;
+	const float FullDistance = ToDesired.Size();
+	const float TargetDistance = FMath::Min(ProbeBlockedDistance, FullDistance);
+	SmoothedBlockedDistance = FMath::Min(SmoothedBlockedDistance, FullDistance);
+	
+	const float InterpSpeed = TargetDistance < SmoothedBlockedDistance ? ProbePullInSpeed : ProbeRecoverSpeed;
+	if (InterpSpeed <= 0.0f || DeltaTime <= 0.0f)
+	{
+		SmoothedBlockedDistance = TargetDistance;
+	}
+	else
+	{
+		SmoothedBlockedDistance = FMath::FInterpConstantTo(SmoothedBlockedDistance, TargetDistance, DeltaTime, InterpSpeed);
+	}
+	
+	UnfixedCameraPosition = DesiredLoc;
+	bIsCameraFixed = SmoothedBlockedDistance < FullDistance - KINDA_SMALL_NUMBER;
+	if (bIsCameraFixed == false)
+	{
+		return;
+	}
+	
+	// 막힌 위치로 소켓 다시 계산
+	const FVector ResultLoc = ArmOrigin + ToDesired.GetSafeNormal() * SmoothedBlockedDistance;
+	const FTransform WorldCamTM(DesiredCamTM.GetRotation(), ResultLoc);
+	const FTransform RelCamTM = WorldCamTM.GetRelativeTransform(GetComponentTransform());
+	
+	RelativeSocketLocation = RelCamTM.GetLocation();
+	RelativeSocketRotation = RelCamTM.GetRotation();
+	
+	UpdateChildTransforms();
+}
+
+bool USkullySpringArmComponent::NeedsProbe(const FVector& ArmOrigin, const FVector& DesiredLoc) const
+{
+	if (bHasProbeResult == false)
+	{
+		return true;
+	}
+	
+	const UWorld* World = GetWorld();
+	if (World != nullptr && World->GetTimeSeconds() - LastProbeTime >= MaxProbeInterval)
+	{
+		return true;
+	}
+	
+	const float ReuseDistanceSq = FMath::Square(ProbeReuseDistance);
+	return FVector::DistSquared(ArmOrigin, LastProbeOrigin) > ReuseDistanceSq
+		|| FVector::DistSquared(DesiredLoc, LastProbeDesiredLoc) > ReuseDistanceSq;
+}
+
+void USkullySpringArmComponent::ProbeSync(const FVector& ArmOrigin, const FVector& DesiredLoc)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+	
+	INC_DWORD_STAT(STAT_SkullyCameraProbesSync);
+	
+	// 진행 중인 비동기 결과는 이번 결과보다 오래됐으므로 버림
+	PendingProbeHandle.Invalidate();
+	
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SkullySpringArm), false, GetOwner());
+	FHitResult Result;
+	World->SweepSingleByChannel(Result, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+	
+	LastProbeTime = World->GetTimeSeconds();
+	StoreProbeResult(ArmOrigin, DesiredLoc, Result.bBlockingHit, Result.Location);
+}
+
+void USkullySpringArmComponent::ProbeAsync(const FVector& ArmOrigin, const FVector& DesiredLoc)
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+	
+	// 이전 요청의 결과를 아직 받지 못했으면 그 결과를 기다림(프레임당 최대 한 번만 요청)
+	if (PendingProbeHandle.IsValid() == true)
+	{
+		INC_DWORD_STAT(STAT_SkullyCameraProbesSkipped);
+		return;
+	}
+	
+	INC_DWORD_STAT(STAT_SkullyCameraProbesAsync);
+	
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SkullySpringArm), false, GetOwner());
+	PendingProbeHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, ArmOrigin, DesiredLoc, FQuat::Identity, ProbeChannel,
+		FCollisionShape::MakeSphere(ProbeSize), QueryParams, FCollisionResponseParams::DefaultResponseParam, &AsyncProbeDelegate);
+	
+	// 요청한 위치를 기준으로 재사용 여부를 판단(결과가 오기 전에 같은 위치로 다시 요청하지 않음)
+	LastProbeOrigin = ArmOrigin;
+	LastProbeDesiredLoc = DesiredLoc;
+	LastProbeTime = World->GetTimeSeconds();
+}
+
+void USkullySpringArmComponent::OnAsyncProbeDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	// 동기 스윕/InvalidateProbe로 버려진 요청
+	if (Handle != PendingProbeHandle)
+	{
+		return;
+	}
+	
+	PendingProbeHandle.Invalidate();
+	
+	const FHitResult* Hit = FHitResult::GetFirstBlockingHit(Datum.OutHits);
+	StoreProbeResult(Datum.Start, Datum.End, Hit != nullptr, Hit != nullptr ? Hit->Location : Datum.End);
+}
+
+void USkullySpringArmComponent::StoreProbeResult(const FVector& ArmOrigin, const FVector& DesiredLoc, bool bBlockingHit, const FVector& HitLocation)
+{
+	LastProbeOrigin = ArmOrigin;
+	LastProbeDesiredLoc = DesiredLoc;
+	bHasProbeResult = true;
+	ProbeBlockedDistance = bBlockingHit == true ? FVector::Dist(ArmOrigin, HitLocation) : MAX_FLT;
+}
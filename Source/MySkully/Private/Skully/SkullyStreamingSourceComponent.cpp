@@ -0,0 +1,273 @@
+/*
+ * 파일명: SkullyStreamingSourceComponent.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully의 속도/이동 방향으로 앞쪽 경로를 예측해 월드 파티션 셀을 미리 로드하는 스트리밍 소스
+ */
+
+#include "Skully/SkullyStreamingSourceComponent.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "MySkully.h"
+#include "Skully/SkullyMovementComponent.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+
+namespace
+{
+	// 동시에 추적하는 예측 지점 수
+	constexpr int32 MaxPendingPredictions = 8;
+}
+
+USkullyStreamingSourceComponent::USkullyStreamingSourceComponent()
+{
+	// 지표 확인용 틱(소스 자체는 월드 파티션이 GetStreamingSources로 가져감)
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickInterval = 0.1f;
+}
+
+void USkullyStreamingSourceComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	
+	MovementComponent = GetOwner()->FindComponentByClass<USkullyMovementComponent>();
+	
+	SourceNames.Reset();
+	for (int32 Index = 0; Index < NumPathSources; ++Index)
+	{
+		SourceNames.Add(FName(*FString::Printf(TEXT("%s_Ahead%d"), *GetOwner()->GetName(), Index)));
+	}
+	
+	if (APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		Pawn->ReceiveControllerChangedDelegate.AddDynamic(this, &USkullyStreamingSourceComponent::OnOwnerControllerChanged);
+	}
+	
+	UpdateProviderRegistration();
+}
+
+void USkullyStreamingSourceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		Pawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &USkullyStreamingSourceComponent::OnOwnerControllerChanged);
+	}
+	
+	if (bRegisteredProvider == true)
+	{
+		if (UWorldPartitionSubsystem* WorldPartitionSubsystem = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>())
+		{
+			WorldPartitionSubsystem->UnregisterStreamingSourceProvider(this);
+		}
+		bRegisteredProvider = false;
+	}
+	
+	if (bLogStreamingMetrics == true && NumArrivals > 0)
+	{
+		UE_LOG(LogSkullyMovement, Log, TEXT("[Streaming] 예측 지점 %d개 도착, 미로드 도착 %d개, 평균 로드 지연 %.2fs, 평균 여유 %.2fs"),
+			NumArrivals, NumLateArrivals, TotalLoadLatency / NumArrivals, TotalArrivalMargin / NumArrivals);
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+bool USkullyStreamingSourceComponent::ShouldProvideSources() const
+{
+	const AActor* Owner = GetOwner();
+	if (Owner == nullptr)
+	{
+		return false;
+	}
+	
+	// 서버는 모든 플레이어 주변 셀이 필요하고, 클라이언트는 자기 Skully 주변만 필요
+	if (Owner->HasAuthority() == true)
+	{
+		return true;
+	}
+	
+	const APawn* Pawn = Cast<APawn>(Owner);
+	return Pawn != nullptr && Pawn->IsLocallyControlled() == true;
+}
+
+void USkullyStreamingSourceComponent::UpdateProviderRegistration()
+{
+	const bool bShouldRegister = ShouldProvideSources();
+	if (bShouldRegister == bRegisteredProvider)
+	{
+		return;
+	}
+	
+	// 월드 파티션이 없는 맵(메인 화면 등)에서는 서브시스템이 없음
+	UWorldPartitionSubsystem* WorldPartitionSubsystem = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>();
+	if (WorldPartitionSubsystem == nullptr)
+	{
+		return;
+	}
+	
+	if (bShouldRegister == true)
+	{
+		WorldPartitionSubsystem->RegisterStreamingSourceProvider(this);
+	}
+	else
+	{
+		WorldPartitionSubsystem->UnregisterStreamingSourceProvider(this);
+		PendingPredictions.Reset();
+	}
+	bRegisteredProvider = bShouldRegister;
+	
+	SetComponentTickEnabled(bRegisteredProvider == true && bLogStreamingMetrics == true);
+}
+
+void USkullyStreamingSourceComponent::OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	UpdateProviderRegistration();
+}
+
+bool USkullyStreamingSourceComponent::GetPredictedPath(FVector& OutOrigin, FVector& OutDirection, float& OutLength) const
+{
+	const USkullyMovementComponent* Movement = MovementComponent.Get();
+	if (Movement == nullptr)
+	{
+		return false;
+	}
+	
+	const float Speed = Movement->GetCurrentSpeed2D();
+	if (Speed < MinPredictionSpeed)
+	{
+		return false;
+	}
+	
+	OutOrigin = GetOwner()->GetActorLocation();
+	OutDirection = Movement->GetCurrentMoveDir2D();
+	OutLength = FMath::Min(Speed * LookAheadTime, MaxLookAheadDistance);
+	
+	return OutLength > KINDA_SMALL_NUMBER;
+}
+
+bool USkullyStreamingSourceComponent::GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const
+{
+	FVector Origin;
+	FVector Direction;
+	float Length;
+	if (GetPredictedPath(Origin, Direction, Length) == false)
+	{
+		return false;
+	}
+	
+	const float Speed = MovementComponent->GetCurrentSpeed2D();
+	const FRotator Rotation = Direction.Rotation();
+	
+	FStreamingSourceShape Shape;
+	Shape.bUseGridLoadingRange = true;
+	Shape.LoadingRangeScale = PathLoadingRangeScale;
+	
+	for (int32 Index = 0; Index < SourceNames.Num(); ++Index)
+	{
+		// 경로를 균등하게 나눈 지점(현재 위치는 기본 플레이어 소스가 담당하므로 제외)
+		const float Alpha = static_cast<float>(Index + 1) / SourceNames.Num();
+		
+		FWorldPartitionStreamingSource Source;
+		Source.Name = SourceNames[Index];
+		Source.Location = Origin + Direction * (Length * Alpha);
+		Source.Rotation = Rotation;
+		Source.TargetState = EStreamingSourceTargetState::Activated;
+		Source.bBlockOnSlowLoading = false;
+		Source.Velocity = Speed;
+		Source.Shapes.Add(Shape);
+		
+		// 먼저 도착할 지점일수록 높은 우선순위(High ~ Low)
+		const uint8 Priority = static_cast<uint8>(FMath::Lerp(
+			static_cast<float>(EStreamingSourcePriority::High), static_cast<float>(EStreamingSourcePriority::Low), Alpha));
+		Source.Priority = static_cast<EStreamingSourcePriority>(Priority);
+		
+		OutStreamingSources.Add(MoveTemp(Source));
+	}
+	
+	return true;
+}
+
+void USkullyStreamingSourceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	
+	const double Now = GetWorld()->GetTimeSeconds();
+	
+	// 경로 끝 지점을 예측 지점으로 기록
+	FVector Origin;
+	FVector Direction;
+	float Length;
+	if (Now - LastPredictionTime >= MetricsSampleInterval
+		&& PendingPredictions.Num() < MaxPendingPredictions
+		&& GetPredictedPath(Origin, Direction, Length) == true)
+	{
+		FPendingPrediction& Prediction = PendingPredictions.AddDefaulted_GetRef();
+		Prediction.Location = Origin + Direction * Length;
+		Prediction.RequestTime = Now;
+		Prediction.ExpectedArrivalTime = Now + Length / MovementComponent->GetCurrentSpeed2D();
+		LastPredictionTime = Now;
+	}
+	
+	UpdateArrivalMetrics(Now);
+}
+
+void USkullyStreamingSourceComponent::UpdateArrivalMetrics(double Now)
+{
+	UWorldPartitionSubsystem* WorldPartitionSubsystem = GetWorld()->GetSubsystem<UWorldPartitionSubsystem>();
+	if (WorldPartitionSubsystem == nullptr)
+	{
+		return;
+	}
+	
+	const FVector CurrentLocation = GetOwner()->GetActorLocation();
+	
+	for (int32 Index = PendingPredictions.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingPrediction& Prediction = PendingPredictions[Index];
+		
+		// 예측 지점 주변 셀이 모두 활성화되었는지
+		if (Prediction.LoadedTime < 0.0)
+		{
+			FWorldPartitionStreamingQuerySource QuerySource;
+			QuerySource.Location = Prediction.Location;
+			QuerySource.Radius = ArrivalRadius;
+			QuerySource.bUseGridLoadingRange = false;
+			
+			if (WorldPartitionSubsystem->IsStreamingCompleted(EWorldPartitionRuntimeCellState::Activated, { QuerySource }, false) == true)
+			{
+				Prediction.LoadedTime = Now;
+			}
+		}
+		
+		if (FVector::DistSquared2D(CurrentLocation, Prediction.Location) <= FMath::Square(ArrivalRadius))
+		{
+			// 도착: 로드 지연과 도착 시간(요청 기준) 비교
+			const double ArrivalTime = Now - Prediction.RequestTime;
+			const bool bLoaded = Prediction.LoadedTime >= 0.0;
+			const double LoadLatency = bLoaded ? Prediction.LoadedTime - Prediction.RequestTime : ArrivalTime;
+			
+			++NumArrivals;
+			TotalLoadLatency += LoadLatency;
+			TotalArrivalMargin += ArrivalTime - LoadLatency;
+			
+			if (bLoaded == true)
+			{
+				UE_LOG(LogSkullyMovement, Verbose, TEXT("[Streaming] 예측 지점 로드 %.2fs, 도착 %.2fs (여유 %.2fs)"),
+					LoadLatency, ArrivalTime, ArrivalTime - LoadLatency);
+			}
+			else
+			{
+				++NumLateArrivals;
+				UE_LOG(LogSkullyMovement, Warning, TEXT("[Streaming] 예측 지점에 로드 완료 전 도착: 도착 %.2fs (예상 %.2fs), 위치 %s"),
+					ArrivalTime, Prediction.ExpectedArrivalTime - Prediction.RequestTime, *Prediction.Location.ToCompactString());
+			}
+			
+			PendingPredictions.RemoveAtSwap(Index);
+		}
+		else if (Now > Prediction.ExpectedArrivalTime + LookAheadTime)
+		{
+			// 방향을 틀어 도착하지 않은 예측은 버림
+			PendingPredictions.RemoveAtSwap(Index);
+		}
+	}
+}
@@ -0,0 +1,40 @@
+/*
+ * 파일명: SkullySurfaceResponse.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 바닥 물리 머티리얼(UPhysicalMaterial)별 Skully 이동 반응(마찰, 슬라이드 감쇠, 정지 임계치, 최대 슬라이드 속도) 테이블
+ */
+
+#include "Skully/SkullySurfaceResponse.h"
+
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Skully/SkullyMovementModel.h"
+
+void FSkullySurfaceResponse::ApplyTo(FSkullyMovementModelParams& Params) const
+{
+	Params.GroundFriction = GroundFriction;
+	Params.SlidingFriction = SlidingFriction;
+	Params.SlideDamping = SlideDamping;
+	Params.StaticFrictionAccel = StaticFrictionAccel;
+	Params.MaxSlopeSlideSpeed = MaxSlopeSlideSpeed;
+}
+
+const FSkullySurfaceResponse* USkullySurfaceResponseTable::Find(const UPhysicalMaterial* PhysicalMaterial) const
+{
+	if (PhysicalMaterial == nullptr)
+	{
+		return nullptr;
+	}
+
+	return Responses.Find(const_cast<UPhysicalMaterial*>(PhysicalMaterial));
+}
+
+#if WITH_EDITOR
+void USkullySurfaceResponseTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	
+	// 플레이 중 에셋을 고치면 컴포넌트들이 다음 스텝에 다시 조회
+	NotifyResponsesChanged();
+}
+#endif
@@ -0,0 +1,346 @@
+/*
+ * 파일명: SkullyWalkabilityField.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 정적 레벨의 2.5D 바닥 격자(높이/노멀/바닥 프리미티브)를 에디터에서 미리 구워 둔 에셋
+ */
+
+#include "Skully/SkullyWalkabilityField.h"
+
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "MySkully.h"
+#include "Skully/SkullyMovementStateCodec.h"
+
+#if WITH_EDITOR
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Skully/SkullyWalkabilitySubsystem.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#endif
+
+namespace
+{
+	// 셀 비트 배치: 높이 [0, 16), 노멀 [16, 40), 바닥 프리미티브 번호 + 1 [40, 56)
+	constexpr int32 CellNormalBits = 12;
+	constexpr int32 CellNormalShift = 16;
+	constexpr int32 CellSurfaceShift = 40;
+	constexpr uint64 CellHeightMask = 0xFFFF;
+	constexpr uint64 CellNormalMask = (1ull << (CellNormalBits * 2)) - 1;
+	constexpr uint64 CellSurfaceMask = 0xFFFF;
+
+	uint64 PackCell(uint32 HeightQuantized, const FVector& Normal, int32 SurfaceIndex)
+	{
+		const uint64 EncodedNormal = SkullyMovementStateCodec::EncodeNormal(Normal, CellNormalBits);
+		return (HeightQuantized & CellHeightMask) |
+			((EncodedNormal & CellNormalMask) << CellNormalShift) |
+			((static_cast<uint64>(SurfaceIndex + 1) & CellSurfaceMask) << CellSurfaceShift);
+	}
+}
+
+void USkullyWalkabilityField::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// 셀은 수십만 개가 될 수 있으므로 원소별 직렬화 대신 메모리 블록 그대로 읽고 씀
+	Cells.BulkSerialize(Ar);
+}
+
+bool USkullyWalkabilityField::GetCellCoord(const FVector& Location, int32& OutX, int32& OutY) const
+{
+	if (CellSize <= 0.0f)
+	{
+		return false;
+	}
+
+	OutX = FMath::FloorToInt32((Location.X - Origin.X) / CellSize);
+	OutY = FMath::FloorToInt32((Location.Y - Origin.Y) / CellSize);
+
+	return OutX >= 0 && OutY >= 0 && OutX < SizeX && OutY < SizeY;
+}
+
+bool USkullyWalkabilityField::GetCell(int32 X, int32 Y, FSkullyWalkabilityCell& OutCell) const
+{
+	if (X < 0 || Y < 0 || X >= SizeX || Y >= SizeY)
+	{
+		return false;
+	}
+
+	const int32 Index = Y * SizeX + X;
+	if (Cells.IsValidIndex(Index) == false)
+	{
+		return false;
+	}
+
+	const uint64 Packed = Cells[Index];
+	const int32 SurfaceIndex = static_cast<int32>((Packed >> CellSurfaceShift) & CellSurfaceMask) - 1;
+	if (SurfaceIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutCell.Height = MinZ + static_cast<float>(Packed & CellHeightMask) * HeightQuantum;
+	OutCell.Normal = SkullyMovementStateCodec::DecodeNormal(static_cast<uint32>((Packed >> CellNormalShift) & CellNormalMask), CellNormalBits);
+	OutCell.SurfaceIndex = SurfaceIndex;
+
+	return true;
+}
+
+FVector2D USkullyWalkabilityField::GetCellCenter(int32 X, int32 Y) const
+{
+	return Origin + FVector2D(X + 0.5f, Y + 0.5f) * CellSize;
+}
+
+FString USkullyWalkabilityField::GetAssetPathForWorld(const UWorld* World)
+{
+	if (World == nullptr)
+	{
+		return FString();
+	}
+
+	// PIE 월드도 원래 맵의 에셋을 사용
+	const FString MapName = FPackageName::GetShortName(UWorld::RemovePIEPrefix(World->GetOutermost()->GetName()));
+	const FString AssetName = MapName + TEXT("_Walkability");
+
+	return FString::Printf(TEXT("/Game/Walkability/%s.%s"), *AssetName, *AssetName);
+}
+
+#if WITH_EDITOR
+
+namespace
+{
+	// 평면 판정 허용치: 모서리 샘플과 중심 평면의 거리(cm), 노멀 내적
+	constexpr float BakePlaneTolerance = 1.0f;
+	constexpr float BakeNormalDotTolerance = 0.999f;
+	// 한 번에 구울 수 있는 최대 셀 수(약 128MB)
+	constexpr int64 BakeMaxCells = 16 * 1024 * 1024;
+
+	struct FBakeSample
+	{
+		FVector Point = FVector::ZeroVector;
+		FVector Normal = FVector::UpVector;
+		UPrimitiveComponent* Component = nullptr;
+	};
+
+	bool IsBakeableSurface(const UPrimitiveComponent* Component)
+	{
+		return Component != nullptr &&
+			Component->Mobility == EComponentMobility::Static &&
+			Component->IsQueryCollisionEnabled() == true &&
+			Component->GetCollisionResponseToChannel(ECC_Visibility) == ECR_Block;
+	}
+
+	// 위에서 아래로 가장 위 바닥 한 점(Static이 아니면 실패)
+	bool TraceBakeSample(const UWorld* World, const FVector2D& XY, float TopZ, float BottomZ, FBakeSample& OutSample)
+	{
+		FHitResult Hit;
+		const FCollisionQueryParams Params(SCENE_QUERY_STAT(SkullyWalkabilityBake), true);
+		if (World->LineTraceSingleByChannel(Hit, FVector(XY, TopZ), FVector(XY, BottomZ), ECC_Visibility, Params) == false || Hit.bStartPenetrating == true)
+		{
+			return false;
+		}
+
+		UPrimitiveComponent* Component = Hit.GetComponent();
+		if (Component == nullptr || Component->Mobility != EComponentMobility::Static)
+		{
+			return false;
+		}
+
+		OutSample.Point = Hit.ImpactPoint;
+		OutSample.Normal = Hit.ImpactNormal;
+		OutSample.Component = Component;
+		return true;
+	}
+}
+
+void USkullyWalkabilityField::Bake(UWorld* World, float InCellSize)
+{
+	Cells.Reset();
+	Surfaces.Reset();
+	SizeX = 0;
+	SizeY = 0;
+	NumBakedCells = 0;
+	CellSize = FMath::Max(InCellSize, 1.0f);
+
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	// 격자 범위: 충돌이 있는 Static 프리미티브 전체
+	FBox Bounds(ForceInit);
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		It->ForEachComponent<UPrimitiveComponent>(false, [&Bounds](const UPrimitiveComponent* Component)
+		{
+			if (IsBakeableSurface(Component) == true)
+			{
+				Bounds += Component->Bounds.GetBox();
+			}
+		});
+	}
+
+	if (Bounds.IsValid == false)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Walkability] 구울 Static 지오메트리가 없습니다."));
+		return;
+	}
+
+	const int64 NumX = FMath::CeilToInt64(Bounds.GetSize().X / CellSize);
+	const int64 NumY = FMath::CeilToInt64(Bounds.GetSize().Y / CellSize);
+	if (NumX * NumY > BakeMaxCells)
+	{
+		UE_LOG(LogSkullyMovement, Warning, TEXT("[Walkability] 셀이 너무 많습니다(%lld x %lld), CellSize를 늘려 주세요."), NumX, NumY);
+		return;
+	}
+
+	Origin = FVector2D(Bounds.Min.X, Bounds.Min.Y);
+	SizeX = static_cast<int32>(NumX);
+	SizeY = static_cast<int32>(NumY);
+	const float TopZ = Bounds.Max.Z + 100.0f;
+	const float BottomZ = Bounds.Min.Z - 100.0f;
+
+	// 격자 꼭짓점 샘플(이웃 셀이 공유)
+	const int32 NumVertexX = SizeX + 1;
+	TArray<FBakeSample> Vertices;
+	TBitArray<> VertexHits(false, NumVertexX * (SizeY + 1));
+	Vertices.SetNum(NumVertexX * (SizeY + 1));
+	for (int32 Y = 0; Y <= SizeY; ++Y)
+	{
+		for (int32 X = 0; X <= SizeX; ++X)
+		{
+			const int32 Index = Y * NumVertexX + X;
+			VertexHits[Index] = TraceBakeSample(World, Origin + FVector2D(X, Y) * CellSize, TopZ, BottomZ, Vertices[Index]);
+		}
+	}
+
+	// 셀 중심 샘플 + 네 꼭짓점이 같은 프리미티브의 같은 평면이면 굽기
+	struct FBakedCell
+	{
+		float Height = 0.0f;
+		FVector Normal = FVector::UpVector;
+		int32 SurfaceIndex = INDEX_NONE;
+	};
+	TArray<FBakedCell> BakedCells;
+	BakedCells.SetNum(SizeX * SizeY);
+
+	TMap<UPrimitiveComponent*, int32> SurfaceIndices;
+	float MaxZ = -UE_BIG_NUMBER;
+	MinZ = UE_BIG_NUMBER;
+
+	for (int32 Y = 0; Y < SizeY; ++Y)
+	{
+		for (int32 X = 0; X < SizeX; ++X)
+		{
+			FBakeSample Center;
+			if (TraceBakeSample(World, GetCellCenter(X, Y), TopZ, BottomZ, Center) == false)
+			{
+				continue;
+			}
+
+			bool bPlanar = true;
+			const int32 CornerIndices[4] = { Y * NumVertexX + X, Y * NumVertexX + X + 1, (Y + 1) * NumVertexX + X, (Y + 1) * NumVertexX + X + 1 };
+			for (const int32 CornerIndex : CornerIndices)
+			{
+				const FBakeSample& Corner = Vertices[CornerIndex];
+				if (VertexHits[CornerIndex] == false ||
+					Corner.Component != Center.Component ||
+					FVector::DotProduct(Corner.Normal, Center.Normal) < BakeNormalDotTolerance ||
+					FMath::Abs(FVector::DotProduct(Corner.Point - Center.Point, Center.Normal)) > BakePlaneTolerance)
+				{
+					bPlanar = false;
+					break;
+				}
+			}
+
+			if (bPlanar == false)
+			{
+				continue;
+			}
+
+			int32* SurfaceIndex = SurfaceIndices.Find(Center.Component);
+			if (SurfaceIndex == nullptr)
+			{
+				if (Surfaces.Num() >= static_cast<int32>(CellSurfaceMask))
+				{
+					continue;
+				}
+
+				// PIE에서 구워도 에디터 맵의 경로로 저장
+				SurfaceIndex = &SurfaceIndices.Add(Center.Component, Surfaces.Add(FSoftObjectPath(UWorld::RemovePIEPrefix(FSoftObjectPath(Center.Component).ToString()))));
+			}
+
+			FBakedCell& Cell = BakedCells[Y * SizeX + X];
+			Cell.Height = Center.Point.Z;
+			Cell.Normal = Center.Normal;
+			Cell.SurfaceIndex = *SurfaceIndex;
+
+			MinZ = FMath::Min(MinZ, Cell.Height);
+			MaxZ = FMath::Max(MaxZ, Cell.Height);
+			++NumBakedCells;
+		}
+	}
+
+	// 높이는 구워진 셀의 높이 범위를 16비트로 나눔
+	if (NumBakedCells == 0)
+	{
+		MinZ = 0.0f;
+		MaxZ = 0.0f;
+	}
+	HeightQuantum = FMath::Max((MaxZ - MinZ) / static_cast<float>(CellHeightMask), 0.01f);
+
+	Cells.SetNumZeroed(SizeX * SizeY);
+	for (int32 Index = 0; Index < BakedCells.Num(); ++Index)
+	{
+		const FBakedCell& Cell = BakedCells[Index];
+		if (Cell.SurfaceIndex != INDEX_NONE)
+		{
+			const uint32 HeightQuantized = static_cast<uint32>(FMath::Clamp(FMath::RoundToInt32((Cell.Height - MinZ) / HeightQuantum), 0, static_cast<int32>(CellHeightMask)));
+			Cells[Index] = PackCell(HeightQuantized, Cell.Normal, Cell.SurfaceIndex);
+		}
+	}
+
+	UE_LOG(LogSkullyMovement, Display, TEXT("[Walkability] 굽기 완료: %d x %d 셀(%.0fcm), 구워진 셀 %d개(%.1f%%), 바닥 프리미티브 %d개, %.1fKB"),
+		SizeX, SizeY, CellSize, NumBakedCells, Cells.Num() > 0 ? 100.0f * NumBakedCells / Cells.Num() : 0.0f, Surfaces.Num(), GetCellBytes() / 1024.0f);
+}
+
+namespace
+{
+	// 현재 월드를 구워서 맵별 에셋 경로에 저장하고 바로 적용
+	void BakeWalkabilityField(const TArray<FString>& Args, UWorld* World)
+	{
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		const float CellSize = Args.Num() > 0 ? FMath::Max(FCString::Atof(*Args[0]), 1.0f) : 50.0f;
+
+		const FString AssetPath = USkullyWalkabilityField::GetAssetPathForWorld(World);
+		const FString PackageName = FPackageName::ObjectPathToPackageName(AssetPath);
+		UPackage* Package = CreatePackage(*PackageName);
+		USkullyWalkabilityField* Field = NewObject<USkullyWalkabilityField>(Package, *FPackageName::GetShortName(PackageName), RF_Public | RF_Standalone);
+		Field->Bake(World, CellSize);
+
+		const FString FileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		if (UPackage::SavePackage(Package, Field, *FileName, SaveArgs) == false)
+		{
+			UE_LOG(LogSkullyMovement, Warning, TEXT("[Walkability] 저장 실패: %s"), *FileName);
+		}
+
+		if (USkullyWalkabilitySubsystem* Walkability = World->GetSubsystem<USkullyWalkabilitySubsystem>())
+		{
+			Walkability->SetField(Field);
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs BakeWalkabilityCommand(
+		TEXT("Skully.Walkability.Bake"),
+		TEXT("현재 맵의 바닥 격자를 구워서 /Game/Walkability/<맵 이름>_Walkability에 저장: Skully.Walkability.Bake [셀 크기=50]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BakeWalkabilityField));
+}
+
+#endif
@@ -0,0 +1,220 @@
+/*
+ * 파일명: SkullyWalkabilitySubsystem.cpp
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 구워진 바닥 격자(USkullyWalkabilityField)를 읽어 바닥 감지를 씬 쿼리 없이 대신하는 월드 서브시스템
+ */
+
+#include "Skully/SkullyWalkabilitySubsystem.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "MySkully.h"
+#include "Skully/SkullyMovementStats.h"
+#include "Skully/SkullyWalkabilityField.h"
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarWalkabilityEnable(
+		TEXT("Skully.Walkability.Enable"),
+		true,
+		TEXT("구워진 바닥 격자로 바닥 감지를 대신할지 여부(끄면 항상 씬 쿼리)"));
+
+	// 발밑 셀이 같은 평면인지 판정하는 허용치(셀 높이 양자화 오차 포함)
+	constexpr float FieldPlaneTolerance = 2.0f;
+	constexpr float FieldNormalDotTolerance = 0.999f;
+	// 이보다 깊이 겹쳐 있으면 씬 쿼리로 겹침 정보를 받아야 함(cm)
+	constexpr float FieldMaxPenetration = 0.5f;
+}
+
+void USkullyWalkabilitySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 맵별 경로에 구워 둔 에셋이 없으면 조용히 씬 쿼리만 사용
+	const FString AssetPath = USkullyWalkabilityField::GetAssetPathForWorld(&InWorld);
+	if (FPackageName::DoesPackageExist(FPackageName::ObjectPathToPackageName(AssetPath)) == true)
+	{
+		SetField(LoadObject<USkullyWalkabilityField>(nullptr, *AssetPath, nullptr, LOAD_NoWarn | LOAD_Quiet));
+	}
+}
+
+void USkullyWalkabilitySubsystem::Deinitialize()
+{
+	SetField(nullptr);
+	DynamicPrimitives.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId USkullyWalkabilitySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkullyWalkabilitySubsystem, STATGROUP_Tickables);
+}
+
+void USkullyWalkabilitySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Field != nullptr)
+	{
+		UpdateDynamicCells();
+	}
+}
+
+void USkullyWalkabilitySubsystem::SetField(USkullyWalkabilityField* NewField)
+{
+	Field = NewField;
+	ResolvedSurfaces.Reset();
+	DynamicCells.Reset();
+
+	if (Field == nullptr)
+	{
+		return;
+	}
+
+	ResolvedSurfaces.SetNum(Field->Surfaces.Num());
+	DynamicCells.Init(false, Field->SizeX * Field->SizeY);
+	UpdateDynamicCells();
+
+	UE_LOG(LogSkullyMovement, Display, TEXT("[Walkability] 바닥 격자 사용: %s(%d x %d, 구워진 셀 %d개, %.1fKB)"),
+		*Field->GetPathName(), Field->SizeX, Field->SizeY, Field->NumBakedCells, Field->GetCellBytes() / 1024.0f);
+}
+
+void USkullyWalkabilitySubsystem::RegisterDynamicPrimitive(UPrimitiveComponent* Primitive)
+{
+	if (Primitive != nullptr)
+	{
+		DynamicPrimitives.AddUnique(Primitive);
+	}
+}
+
+void USkullyWalkabilitySubsystem::UnregisterDynamicPrimitive(UPrimitiveComponent* Primitive)
+{
+	DynamicPrimitives.RemoveSwap(Primitive);
+}
+
+void USkullyWalkabilitySubsystem::UpdateDynamicCells()
+{
+	DynamicCells.SetRange(0, DynamicCells.Num(), false);
+	DynamicPrimitives.RemoveAllSwap([](const TWeakObjectPtr<UPrimitiveComponent>& Primitive) { return Primitive.IsValid() == false; });
+
+	for (const TWeakObjectPtr<UPrimitiveComponent>& Primitive : DynamicPrimitives)
+	{
+		// 한 셀 여유를 두고 표시(셀 경계에 걸친 구의 발밑)
+		const FBox Box = Primitive->Bounds.GetBox().ExpandBy(Field->CellSize);
+		const int32 MinX = FMath::Max(FMath::FloorToInt32((Box.Min.X - Field->Origin.X) / Field->CellSize), 0);
+		const int32 MinY = FMath::Max(FMath::FloorToInt32((Box.Min.Y - Field->Origin.Y) / Field->CellSize), 0);
+		const int32 MaxX = FMath::Min(FMath::FloorToInt32((Box.Max.X - Field->Origin.X) / Field->CellSize), Field->SizeX - 1);
+		const int32 MaxY = FMath::Min(FMath::FloorToInt32((Box.Max.Y - Field->Origin.Y) / Field->CellSize), Field->SizeY - 1);
+
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			if (MinX <= MaxX)
+			{
+				DynamicCells.SetRange(Y * Field->SizeX + MinX, MaxX - MinX + 1, true);
+			}
+		}
+	}
+}
+
+UPrimitiveComponent* USkullyWalkabilitySubsystem::ResolveSurface(int32 SurfaceIndex)
+{
+	if (ResolvedSurfaces.IsValidIndex(SurfaceIndex) == false)
+	{
+		return nullptr;
+	}
+
+	TWeakObjectPtr<UPrimitiveComponent>& Resolved = ResolvedSurfaces[SurfaceIndex];
+	if (Resolved.IsValid() == false)
+	{
+		// 월드 파티션/레벨 스트리밍으로 나중에 로드될 수 있으므로 매번 다시 찾음(없으면 씬 쿼리로 대체)
+		FSoftObjectPath Path = Field->Surfaces[SurfaceIndex];
+#if WITH_EDITOR
+		if (GetWorld()->IsPlayInEditor() == true)
+		{
+			Path.FixupForPIE();
+		}
+#endif
+		Resolved = Cast<UPrimitiveComponent>(Path.ResolveObject());
+	}
+
+	return Resolved.Get();
+}
+
+bool USkullyWalkabilitySubsystem::SweepGround(const FVector& Center, float Radius, float SweepDistance, float MaxDistance, float MinNormalZ, FHitResult& OutHit)
+{
+	if (Field == nullptr || CVarWalkabilityEnable.GetValueOnGameThread() == false)
+	{
+		return false;
+	}
+
+	// 기준 셀: 구 중심 바로 아래 셀의 평면
+	int32 CenterX;
+	int32 CenterY;
+	FSkullyWalkabilityCell Cell;
+	if (Field->GetCellCoord(Center, CenterX, CenterY) == false || Field->GetCell(CenterX, CenterY, Cell) == false || Cell.Normal.Z < MinNormalZ)
+	{
+		return false;
+	}
+
+	const FVector2D CellCenter = Field->GetCellCenter(CenterX, CenterY);
+	const FVector PlanePoint(CellCenter, Cell.Height);
+
+	// 구가 평면에 닿을 때까지 내려가는 거리: (중심 - 평면점)·N - R = t * N.Z
+	const float Distance = (FVector::DotProduct(Center - PlanePoint, Cell.Normal) - Radius) / Cell.Normal.Z;
+	if (Distance < -FieldMaxPenetration || Distance > MaxDistance || Distance > SweepDistance)
+	{
+		return false;
+	}
+
+	// 구 발밑(반지름 범위)의 모든 셀이 같은 프리미티브의 같은 평면이어야 다른 지오메트리에 먼저 닿지 않음
+	const int32 MinX = FMath::FloorToInt32((Center.X - Radius - Field->Origin.X) / Field->CellSize);
+	const int32 MinY = FMath::FloorToInt32((Center.Y - Radius - Field->Origin.Y) / Field->CellSize);
+	const int32 MaxX = FMath::FloorToInt32((Center.X + Radius - Field->Origin.X) / Field->CellSize);
+	const int32 MaxY = FMath::FloorToInt32((Center.Y + Radius - Field->Origin.Y) / Field->CellSize);
+	const float PlaneTolerance = FieldPlaneTolerance + Field->HeightQuantum;
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			FSkullyWalkabilityCell Other;
+			if (Field->GetCell(X, Y, Other) == false ||
+				DynamicCells[Y * Field->SizeX + X] == true ||
+				Other.SurfaceIndex != Cell.SurfaceIndex ||
+				FVector::DotProduct(Other.Normal, Cell.Normal) < FieldNormalDotTolerance ||
+				FMath::Abs(FVector::DotProduct(FVector(Field->GetCellCenter(X, Y), Other.Height) - PlanePoint, Cell.Normal)) > PlaneTolerance)
+			{
+				return false;
+			}
+		}
+	}
+
+	UPrimitiveComponent* Surface = ResolveSurface(Cell.SurfaceIndex);
+	if (Surface == nullptr)
+	{
+		return false;
+	}
+
+	// 씬 쿼리 스윕과 같은 형식의 히트
+	const float HitDistance = FMath::Max(Distance, 0.0f);
+	const FVector HitLocation = Center - FVector::UpVector * HitDistance;
+
+	OutHit = FHitResult(SweepDistance > 0.0f ? HitDistance / SweepDistance : 0.0f);
+	OutHit.bBlockingHit = true;
+	OutHit.Distance = HitDistance;
+	OutHit.Location = HitLocation;
+	OutHit.ImpactPoint = HitLocation - Cell.Normal * Radius;
+	OutHit.Normal = Cell.Normal;
+	OutHit.ImpactNormal = Cell.Normal;
+	OutHit.TraceStart = Center;
+	OutHit.TraceEnd = Center - FVector::UpVector * SweepDistance;
+	OutHit.Component = Surface;
+	OutHit.HitObjectHandle = FActorInstanceHandle(Surface->GetOwner());
+	INC_DWORD_STAT(STAT_SkullyGroundSweepsFromField);
+
+	return true;
+}
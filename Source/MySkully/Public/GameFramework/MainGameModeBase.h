@@ -1,7 +1,7 @@
 /*
  * 파일명: MainGameModeBase.h
  * 생성일: 2026-01-07
- * 수정일: 2026-01-09
+ * 수정일: 2026-10-17
  * 내용: 메인 화면 게임 모드
  */
 
@@ -9,10 +9,18 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "Components/SlateWrapperTypes.h"
+#include "UObject/ObjectKey.h"
 #include "MainGameModeBase.generated.h"
 
 class UUserWidget;
+struct FStreamableHandle;
 
+/**
+ * 메뉴 위젯 스택
+ * 위젯은 클래스당 하나만 만들어 뷰포트에 한 번만 추가하고, 이후 전환은 Visibility만 바꾼다.
+ * (RemoveFromParent/AddToViewport 반복으로 인한 Slate 재구성과 위젯 재생성 GC를 피함)
+ */
 UCLASS()
 class MYSKULLY_API AMainGameModeBase : public AGameModeBase
 {
@@ -21,10 +29,43 @@ class MYSKULLY_API AMainGameModeBase : public AGameModeBase
 public:
 	AMainGameModeBase();
 	
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	
 public:
+	// 스택 맨 위 위젯 교체(위젯 클래스별로 재사용: 같은 클래스의 위젯이 이미 풀에 있으면 그 인스턴스를 보여줌, currentWidget으로 확인)
 	UFUNCTION(BlueprintCallable, Category = "Option")
 	void SetWidget(UUserWidget* widget);
 	
+	// 클래스별로 재사용하는 위젯으로 스택 맨 위 교체
+	UFUNCTION(BlueprintCallable, Category = "Viewport")
+	UUserWidget* ShowWidget(TSubclassOf<UUserWidget> widgetClass);
+	
+	// 재사용 위젯을 스택에 쌓음(PopWidget으로 이전 위젯으로 돌아감)
+	UFUNCTION(BlueprintCallable, Category = "Viewport")
+	UUserWidget* PushWidget(TSubclassOf<UUserWidget> widgetClass);
+	UFUNCTION(BlueprintCallable, Category = "Viewport")
+	void PopWidget();
+	
+	// 클래스별 재사용 위젯(없으면 만들어 숨긴 채로 뷰포트에 추가)
+	UFUNCTION(BlueprintCallable, Category = "Viewport")
+	UUserWidget* GetPooledWidget(TSubclassOf<UUserWidget> widgetClass);
+	
+private:
+	// 숨긴 채로 뷰포트에 추가(이미 추가되어 있으면 무시)
+	void RegisterWidget(UUserWidget* widget);
+	// 위젯 보이기/숨기기(원래 Visibility 복원)
+	void ShowPooledWidget(UUserWidget* widget);
+	void HidePooledWidget(UUserWidget* widget);
+	// 스택에서 빠진 위젯 정리(재사용 위젯은 숨김, 풀에 없는 위젯은 RemoveFromParent)
+	void ReleaseWidget(UUserWidget* widget);
+	
+	// preloadWidgetClasses 비동기 로드
+	void PreloadWidgetClasses();
+	void OnWidgetClassesPreloaded();
+	
+public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Viewport")
 	UUserWidget* currentWidget;
 	
@@ -33,4 +74,27 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport")
 	TSubclassOf<UUserWidget> optionWidget;
+	
+	// BeginPlay에서 비동기로 로드해 둘 위젯 클래스(메뉴에서 처음 열 때 로드 대기가 없도록)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport")
+	TArray<TSoftClassPtr<UUserWidget>> preloadWidgetClasses;
+	
+	// 프리로드 완료 시 preloadWidgetClasses의 위젯 인스턴스까지 미리 만들어 숨겨둠
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport")
+	bool bPrewarmWidgets = true;
+	
+private:
+	// 클래스당 하나의 위젯 인스턴스
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, TObjectPtr<UUserWidget>> widgetPool;
+	
+	// 화면에 쌓인 위젯(맨 뒤가 currentWidget)
+	UPROPERTY()
+	TArray<TObjectPtr<UUserWidget>> widgetStack;
+	
+	// 뷰포트에 추가할 때의 원래 Visibility(보일 때 복원)
+	TMap<TObjectKey<UUserWidget>, ESlateVisibility> shownVisibility;
+	
+	TSharedPtr<FStreamableHandle> preloadHandle;
+	double preloadRequestTime = 0.0;
 };
@@ -1,7 +1,7 @@
 /*
  * 파일명: Skully.h
  * 생성일: 2026-01-08
- * 수정일: 2026-01-09
+ * 수정일: 2026-10-17
  * 내용: 플레이어 객체 Skully
  */
 
@@ -10,14 +10,20 @@
 #include "CoreMinimal.h"
 #include "Components/SphereComponent.h"
 #include "GameFramework/Pawn.h"
+#include "Skully/SkullyInputRecording.h"
 #include "Skully.generated.h"
 
+struct FStreamableHandle;
+
 class UArrowComponent;
 class UCameraComponent;
 class USpringArmComponent;
 class USkullyMovementComponent;
+class USkullyStreamingSourceComponent;
 class USphereComponent;
+class USkeletalMesh;
 class USkeletalMeshComponent;
+class UStaticMesh;
 class UStaticMeshComponent;
 class UPawnMovementComponent;
 class UInputMappingContext;
@@ -33,11 +39,26 @@ public:
 	ASkully();
 
 protected:
+	virtual void OnConstruction(const FTransform& Transform) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
+	
+	// 입력 녹화 시작(시작 이동 상태/컨트롤 회전 + 틱마다 월드 기준 이동 입력/컨트롤 회전/DeltaTime 기록)
+	UFUNCTION(BlueprintCallable, Category = "Input|Recording")
+	void StartInputRecording();
+	// 입력 녹화 종료 후 파일로 저장(이름만 주면 Saved/SkullyInput/<이름>.skinput)
+	UFUNCTION(BlueprintCallable, Category = "Input|Recording")
+	bool StopInputRecording(const FString& NameOrPath);
+	
+	// 녹화된 입력 재생 시작(재생 중에는 실제 입력을 무시하고 녹화된 DeltaTime으로 이동을 진행)
+	UFUNCTION(BlueprintCallable, Category = "Input|Recording")
+	bool StartInputReplay(const FString& NameOrPath);
+	UFUNCTION(BlueprintCallable, Category = "Input|Recording")
+	void StopInputReplay();
 
 private:
 	// Collision
@@ -54,6 +75,16 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Mesh", meta = (AllowPrivateAccess="true"))
 	UStaticMeshComponent* Skully_Clay;
 	
+	// 메시 에셋(소프트 참조, BeginPlay에서 비동기 로드하므로 폰 클래스 로드 시 메시를 끌고 오지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mesh", meta = (AllowPrivateAccess="true"))
+	TSoftObjectPtr<USkeletalMesh> BoneMeshAsset;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mesh", meta = (AllowPrivateAccess="true"))
+	TSoftObjectPtr<UStaticMesh> ClayMeshAsset;
+	
+	// 로드가 끝날 때까지 Skully_Clay에 대신 보여줄 가벼운 메시(콜라이더 크기에 맞춰 스케일)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mesh", meta = (AllowPrivateAccess="true"))
+	UStaticMesh* PlaceholderMesh;
+	
 	// Camera
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess="true"))
 	USpringArmComponent* CameraSpringArm;
@@ -64,6 +95,10 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess="true"))
 	USkullyMovementComponent* MovementComponent;
 	
+	// Streaming
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Streaming", meta = (AllowPrivateAccess="true"))
+	USkullyStreamingSourceComponent* StreamingSourceComponent;
+	
 	// Input
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input", meta = (AllowPrivateAccess="true"))
 	UInputMappingContext* InputMappingContext;
@@ -79,4 +114,28 @@ protected:
 	void Move(const FInputActionValue& Value);
 	void Look(const FInputActionValue& Value);
 	
+private:
+	// 녹화/재생 중일 때만 액터 Tick을 켬
+	void UpdateTickEnabled();
+	
+	// 메시 에셋 비동기 로드 요청(이미 메모리에 있으면 바로 적용)
+	void RequestMeshAssets();
+	void OnMeshAssetsLoaded();
+	// 로드된 메시를 컴포넌트에 적용하고 플레이스홀더 해제
+	void ApplyMeshAssets();
+	
+private:
+	// 입력 녹화
+	bool bIsRecordingInput = false;
+	FSkullyInputStream RecordedInput;
+	
+	// 입력 재생
+	FSkullyInputReplayer InputReplayer;
+	
+	// 메시 에셋 로드
+	TSharedPtr<FStreamableHandle> MeshLoadHandle;
+	double MeshLoadRequestTime = 0.0;
+	// 플레이스홀더를 보여 주는 동안 저장해 둔 Skully_Clay의 원래 스케일
+	FVector ClayAuthoredScale = FVector::OneVector;
+	bool bClayPlaceholderShown = false;
 };
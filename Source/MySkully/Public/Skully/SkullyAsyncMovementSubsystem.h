@@ -0,0 +1,83 @@
+/*
+ * 파일명: SkullyAsyncMovementSubsystem.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 구 이동을 Chaos 비동기 물리(물리 스레드 고정 틱 콜백)에서 적분하고 게임 스레드에서 결과를 보간하는 월드 서브시스템
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Skully/SkullyMovementKernel.h"
+#include "SkullyAsyncMovementSubsystem.generated.h"
+
+class FSkullyAsyncMovementCallback;
+
+/**
+ * 비동기 물리 이동
+ * - 게임 스레드: 바디마다 입력/이동 모델 파라미터를 모아 프레임당 한 번 물리 스레드로 넘기고, 받은 결과 두 개 사이를 보간해서 돌려준다.
+ * - 물리 스레드: 물리 스텝마다(p.TickPhysicsAsync면 고정 간격) 바디별로 속도 단계(SkullyMovementKernel::StepVelocity)와
+ *   Sweep 이동/지면 판정(SkullyMovementKernel::MoveSphere)을 물리 스레드 씬 쿼리로 실행한다.
+ * 입력은 매 프레임 전체 바디 목록으로 보내므로(델타 아님) 물리 스텝이 프레임 입력을 건너뛰어도 추가/제거/순간이동이 사라지지 않는다.
+ * 결과는 물리 스텝 하나 뒤를 보여 준다(보간 지연).
+ */
+UCLASS()
+class MYSKULLY_API USkullyAsyncMovementSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 바디 추가(QueryParams는 물리 스레드 Sweep에 그대로 사용), 반환값은 바디 ID, 물리 씬이 없으면 INDEX_NONE
+	int32 AddBody(const FSkullyKernelBodyState& State, float Radius, const FCollisionQueryParams& QueryParams);
+	void RemoveBody(int32 BodyId);
+
+	// 다음 물리 스텝부터 사용할 입력(월드 방향, 크기 1 이하)과 이동 모델 파라미터
+	void SetBodyInput(int32 BodyId, const FVector& Input, const FSkullyMovementModelParams& Params);
+	// 물리 스레드의 상태를 덮어씀(순간이동, 충격)
+	void TeleportBody(int32 BodyId, const FSkullyKernelBodyState& State);
+
+	// 보간한 위치와 마지막 결과의 속도/바닥 상태(아직 결과가 없으면 false)
+	bool GetBodyState(int32 BodyId, FSkullyKernelBodyState& OutState);
+
+private:
+	// 바디별 게임 스레드 상태
+	struct FAsyncBody
+	{
+		float Radius = 0.0f;
+		FCollisionQueryParams QueryParams;
+		FVector Input = FVector::ZeroVector;
+		FSkullyMovementModelParams Params;
+		// 증가하면 물리 스레드가 TeleportState로 덮어씀
+		uint32 TeleportGeneration = 0;
+		FSkullyKernelBodyState TeleportState;
+
+		// 받은 결과 중 마지막 두 개(보간 구간)
+		FSkullyKernelBodyState PrevState;
+		FSkullyKernelBodyState LatestState;
+		bool bHasOutput = false;
+	};
+
+	// 물리 스레드 콜백 등록(처음 바디를 추가할 때)
+	bool EnsureCallback();
+	// 이번 프레임 입력 전달
+	void PushInputs();
+	// 도착한 결과 소비(프레임당 한 번)
+	void ConsumeOutputs();
+
+private:
+	FSkullyAsyncMovementCallback* Callback = nullptr;
+
+	TMap<int32, FAsyncBody> Bodies;
+	int32 NextBodyId = 0;
+
+	// 보간: 마지막 두 결과의 물리 시간과 마지막 결과를 받은 게임 시간
+	double PrevOutputTime = 0.0;
+	double LatestOutputTime = 0.0;
+	double LatestOutputArrivalTime = 0.0;
+	uint64 LastConsumedFrame = 0;
+};
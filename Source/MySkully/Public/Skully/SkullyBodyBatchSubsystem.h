@@ -0,0 +1,102 @@
+/*
+ * 파일명: SkullyBodyBatchSubsystem.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 다수의 구형 바디(굴러다니는 해골 소품/NPC)를 SoA 배열로 보관하고 한 번의 병렬 패스로 이동시키는 배치 시뮬레이터
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Skully/SkullyMovementModel.h"
+#include "SkullyBodyBatchSubsystem.generated.h"
+
+/**
+ * 구형 바디 배치 시뮬레이터
+ * USkullyMovementComponent와 같은 이동 모델(SkullyMovementModel)을 사용하지만, 액터/컴포넌트 없이 바디 상태만 배열로 들고 있다.
+ * - 바디끼리는 충돌하지 않고, 월드 지오메트리에만 Sweep으로 충돌한다.
+ * - 바디 한 개의 스텝은 다른 바디를 읽지 않으므로 ParallelFor로 나눠서 처리한다(씬 쿼리만 읽기).
+ * - 컴포넌트와 달리 downhill 샘플링/2-pass 바닥 재투영/쿼리 캐시는 하지 않는다(가벼운 군중용).
+ */
+UCLASS()
+class MYSKULLY_API USkullyBodyBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 바디 추가, 반환값은 바디 ID(제거 전까지 유지)
+	int32 AddBody(const FVector& Location, float Radius, const FVector& InitialVelocity = FVector::ZeroVector);
+	// 바디 제거(마지막 바디를 빈 자리로 옮김)
+	void RemoveBody(int32 BodyId);
+	void RemoveAllBodies();
+
+	int32 GetNumBodies() const { return Positions.Num(); }
+
+	// 바디의 이동 입력(월드 방향, 크기 1 이하) 설정
+	void SetBodyInput(int32 BodyId, const FVector& WorldInput);
+	bool GetBodyLocation(int32 BodyId, FVector& OutLocation) const;
+
+	// 렌더링(인스턴스 메시 등)에서 한 번에 읽을 위치 배열(인덱스 순서, ID 순서 아님)
+	TConstArrayView<FVector> GetBodyLocations() const { return Positions; }
+
+	// 이동 모델 파라미터(기본값은 USkullyMovementComponent 기본 튜닝 값)
+	void SetModelParams(const FSkullyMovementModelParams& InParams) { ModelParams = InParams; }
+	const FSkullyMovementModelParams& GetModelParams() const { return ModelParams; }
+
+	// 모든 바디를 한 스텝 진행(Tick에서 고정 스텝으로 호출, 벤치마크에서 직접 호출)
+	void StepBodies(float DeltaTime);
+
+public:
+	// Tick 자동 진행 여부(벤치마크처럼 외부에서 StepBodies를 직접 부를 때는 끔)
+	bool bAutoStep = true;
+
+	// 고정 스텝 간격(초)과 프레임당 최대 스텝 수
+	float FixedTimestep = 1.0f / 60.0f;
+	int32 MaxStepsPerFrame = 4;
+
+	// ParallelFor 한 작업 단위의 최소 바디 수
+	// 늘리면? 작업 분배 오버헤드 감소, 바디 수가 적을 때 병렬성 감소
+	// 줄이면? 코어를 더 고르게 쓰지만 작업 분배 오버헤드 증가
+	int32 MinBodiesPerTask = 32;
+
+	// 속도 단계를 바디 4개씩 SIMD 커널(SkullyMovementKernel)로 처리할지 여부
+	// 끄면 바디마다 스칼라 경로(SkullyMovementModel)로 처리한다. 결과는 float 오차 범위 안에서 같다(Skully.Bench.Kernel로 확인)
+	bool bUseSimdKernel = true;
+
+private:
+	// 바디 한 개의 한 스텝: 중력 -> 경사 미끄러짐 -> 마찰 -> 입력 가속 -> Sweep 이동 -> 지면 판정
+	void StepBody(int32 Index, float DeltaTime);
+	// FirstIndex부터 바디 4개의 속도 단계를 SIMD 커널로 처리한 뒤 바디마다 MoveBody
+	void StepBodyGroup(int32 FirstIndex, float DeltaTime);
+	// 속도 단계 이후: Sweep 이동 -> 지면 판정
+	void MoveBody(int32 Index, const FVector& MoveDelta, float DeltaTime);
+
+	// 바디 ID <-> 배열 인덱스
+	int32 AllocateBodyId(int32 Index);
+
+private:
+	FSkullyMovementModelParams ModelParams;
+
+	// 바디 상태(SoA): 같은 인덱스가 같은 바디
+	// StepBody/StepBodyGroup은 자기 인덱스의 원소만 쓰므로 병렬 패스에서 락이 필요 없다
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> CachedFloorNormals;
+	TArray<FVector> LastFloorNormals;
+	TArray<uint8> GroundedFlags;
+	TArray<uint8> SlideFlags;
+	TArray<FVector> Inputs;
+	TArray<float> Radii;
+
+	// 배열 인덱스 -> 바디 ID, 바디 ID -> 배열 인덱스(INDEX_NONE이면 빈 ID)
+	TArray<int32> IndexToBodyId;
+	TArray<int32> BodyIdToIndex;
+	TArray<int32> FreeBodyIds;
+
+	float TimeAccumulator = 0.0f;
+};
@@ -0,0 +1,90 @@
+/*
+ * 파일명: SkullyDownhillSampler.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 주변 바닥 높이를 샘플링해서 downhill 방향을 추정하는 샘플러(동기/비동기 배치)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "SkullyDownhillSampler.generated.h"
+
+// downhill 샘플 방향 수
+UENUM(BlueprintType)
+enum class ESkullyDownhillSampleCount : uint8
+{
+	Four = 4,
+	Eight = 8,
+	Sixteen = 16
+};
+
+// downhill 샘플 요청 파라미터
+struct FSkullyDownhillSampleParams
+{
+	// 샘플 기준 위치(구의 중심)
+	FVector Origin = FVector::ZeroVector;
+	// 기준 위치에서 샘플까지의 수평 거리
+	float SampleDistance = 0.0f;
+	// 샘플 위치에서 아래로 라인트레이스를 쏘는 거리
+	float TraceDown = 0.0f;
+	// 무시할 액터(자기 자신)
+	const AActor* IgnoreActor = nullptr;
+	// 샘플 방향 수
+	int32 NumDirections = 4;
+	// 삼각형 기반(Complex)으로 감지할지 여부
+	bool bTraceComplex = false;
+};
+
+// downhill 샘플 결과
+struct FSkullyDownhillSampleResult
+{
+	// 기준 높이보다 낮은 샘플이 있었는지
+	bool bFound = false;
+	// 가장 낮은 샘플 방향
+	FVector Dir = FVector::ZeroVector;
+	// 모든 샘플이 Static 지오메트리에 맞았는지(다음 스텝에서도 결과를 재사용할 수 있는지)
+	bool bAllStatic = false;
+	// 이번 호출에서 새로 요청한 라인트레이스 수
+	int32 NumTracesIssued = 0;
+};
+
+/**
+ * 엣지/경계에서 바닥 노멀이 튀어 슬라이드/투영이 0으로 붕괴할 때, 주변 바닥 높이로 진짜 내리막 방향을 구한다.
+ * 동기 모드는 모든 방향을 즉시 라인트레이스하고,
+ * 비동기 모드는 UWorld 비동기 트레이스로 한 번에 배치 요청한 뒤 다음 틱에 결과를 소비한다(게임 스레드 대기 없음).
+ */
+class MYSKULLY_API FSkullyDownhillSampler
+{
+public:
+	// 동기 샘플: 모든 방향을 즉시 라인트레이스
+	static void SampleSync(UWorld* World, const FSkullyDownhillSampleParams& Params, FSkullyDownhillSampleResult& OutResult);
+	
+	// 비동기 샘플: 이전 틱에 요청한 배치가 완료되어 있고 기준 위치가 ReuseDistance 이내면 그 결과를 반환
+	// 사용할 결과가 없으면 새 배치를 요청하고 false 반환(결과는 다음 틱부터 사용 가능)
+	bool SampleAsync(UWorld* World, const FSkullyDownhillSampleParams& Params, float ReuseDistance, FSkullyDownhillSampleResult& OutResult);
+	
+	// 진행 중인 비동기 배치 폐기
+	void Reset();
+	
+private:
+	// 비동기 배치 요청(반환값: 요청한 트레이스 수)
+	int32 RequestAsync(UWorld* World, const FSkullyDownhillSampleParams& Params);
+	
+	// 샘플 방향 목록(XY 평면, 균등 분할)
+	static const TArray<FVector>& GetSampleDirections(int32 NumDirections);
+	// 샘플 라인트레이스 공통 쿼리 파라미터
+	static FCollisionQueryParams MakeQueryParams(const FSkullyDownhillSampleParams& Params);
+	
+	// 샘플 하나를 평가해서 가장 낮은 방향 갱신
+	static void AccumulateSample(const FVector& Dir, const FHitResult* Hit, float& InOutBestZ, FVector& InOutBestDir, bool& InOutAllStatic);
+	
+private:
+	// 진행 중인 비동기 트레이스 핸들(방향 순서와 동일)
+	TArray<FTraceHandle> PendingTraces;
+	// 진행 중인 배치의 샘플 방향 수
+	int32 PendingNumDirections = 0;
+	// 진행 중인 배치의 기준 위치
+	FVector PendingOrigin = FVector::ZeroVector;
+};
@@ -0,0 +1,88 @@
+/*
+ * 파일명: SkullyGhost.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 녹화된 고스트 궤적을 스트리밍으로 읽어 따라 움직이는 고스트 액터(충돌 없음)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Skully/SkullyGhostTrajectory.h"
+#include "SkullyGhost.generated.h"
+
+class UStaticMeshComponent;
+enum class ESkullyMovementMode;
+
+/**
+ * 고스트 레이스 재생 액터
+ * FSkullyGhostReader로 키를 하나씩 읽어 직전/다음 키 두 개만 들고 보간하므로,
+ * 여러 고스트를 동시에 띄워도 고스트당 메모리는 청크 하나 분량으로 일정하다.
+ * 물리/충돌 없이 트랜스폼만 옮기며, 재생이 끝나면 마지막 키에 멈추고 Tick을 끈다.
+ * 궤적에는 회전이 없으므로 구르기 회전은 Skully 비주얼과 같은 식(수평 이동 거리 / 반지름)으로 직접 누적한다.
+ */
+UCLASS()
+class MYSKULLY_API ASkullyGhost : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASkullyGhost();
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	// 궤적 파일 재생 시작(이름만 주면 Saved/SkullyGhost/<이름>.skghost)
+	UFUNCTION(BlueprintCallable, Category = "Ghost")
+	bool StartPlayback(const FString& NameOrPath);
+	UFUNCTION(BlueprintCallable, Category = "Ghost")
+	void StopPlayback();
+
+	UFUNCTION(BlueprintPure, Category = "Ghost")
+	bool IsPlaying() const { return bPlaying; }
+	UFUNCTION(BlueprintPure, Category = "Ghost")
+	float GetPlaybackTime() const { return static_cast<float>(PlaybackTime); }
+	// 현재 구간의 이동 모드가 Grounded인지(착지/낙하 연출용)
+	UFUNCTION(BlueprintPure, Category = "Ghost")
+	bool IsGhostGrounded() const;
+
+	ESkullyMovementMode GetMovementMode() const;
+
+protected:
+	// 재생이 끝났을 때(마지막 키 도달)
+	UFUNCTION(BlueprintImplementableEvent, Category = "Ghost")
+	void OnPlaybackFinished();
+
+private:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Mesh", meta = (AllowPrivateAccess="true"))
+	UStaticMeshComponent* GhostMesh;
+
+	// 녹화된 구 콜라이더 반지름에 맞춰 메시 스케일 조정(엔진 기본 구의 반지름은 50)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mesh", meta = (AllowPrivateAccess="true"))
+	bool bScaleMeshToBodyRadius = true;
+
+	// 수평 이동에 맞춰 메시를 굴림
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mesh", meta = (AllowPrivateAccess="true"))
+	bool bRollMesh = true;
+
+private:
+	// 보간된 위치로 옮기고 직전 위치에서 움직인 만큼 구르기 회전 누적
+	void MoveGhostTo(const FVector& NewLocation);
+	void FinishPlayback();
+
+private:
+	FSkullyGhostReader Reader;
+	// 보간 구간(직전 키, 다음 키)
+	FSkullyGhostKey PrevKey;
+	FSkullyGhostKey NextKey;
+	bool bHasNextKey = false;
+
+	double PlaybackTime = 0.0;
+	bool bPlaying = false;
+
+	FQuat RollRotation = FQuat::Identity;
+};
@@ -0,0 +1,65 @@
+/*
+ * 파일명: SkullyGhostSubsystem.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 타임 트라이얼 고스트 레이스 녹화(고정 주기 샘플링 -> 궤적 파일 스트리밍 쓰기)와 고스트 액터 생성/관리 월드 서브시스템
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skully/SkullyGhostTrajectory.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkullyGhostSubsystem.generated.h"
+
+class ASkullyGhost;
+class USkullyMovementComponent;
+
+/**
+ * 고스트 레이스
+ * 녹화 중에는 Skully.Ghost.SampleRate 주기로 몸체의 위치와 이동 모드를 FSkullyGhostWriter에 넘기고,
+ * 쓰기 쪽이 키 축약과 청크 단위 파일 쓰기를 맡는다(녹화 길이와 상관없이 메모리 일정).
+ * 재생은 고스트 액터마다 파일을 따로 열어 스트리밍하므로 여러 고스트를 실제 폰과 함께 띄울 수 있다.
+ */
+UCLASS()
+class MYSKULLY_API USkullyGhostSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 몸체 궤적 녹화 시작(이미 녹화 중이면 저장하고 새로 시작, 이름만 주면 Saved/SkullyGhost/<이름>.skghost)
+	UFUNCTION(BlueprintCallable, Category = "Ghost")
+	bool StartRecording(USkullyMovementComponent* Body, const FString& NameOrPath);
+	// 녹화 종료(남은 키를 쓰고 파일을 닫음)
+	UFUNCTION(BlueprintCallable, Category = "Ghost")
+	bool StopRecording();
+
+	UFUNCTION(BlueprintPure, Category = "Ghost")
+	bool IsRecording() const { return Writer.IsOpen(); }
+
+	// 궤적 파일로 고스트를 띄워 처음부터 재생(Skully.Ghost.MaxGhosts를 넘으면 가장 오래된 고스트 제거)
+	UFUNCTION(BlueprintCallable, Category = "Ghost")
+	ASkullyGhost* SpawnGhost(const FString& NameOrPath, TSubclassOf<ASkullyGhost> GhostClass);
+	// 띄운 고스트 모두 제거
+	UFUNCTION(BlueprintCallable, Category = "Ghost")
+	void ClearGhosts();
+
+private:
+	// 현재 몸체 상태를 Tick번째 샘플로 기록
+	void RecordSample(int32 Tick);
+
+private:
+	// 녹화
+	FSkullyGhostWriter Writer;
+	TWeakObjectPtr<USkullyMovementComponent> RecordedBody;
+	FString RecordingPath;
+	double RecordTime = 0.0;
+	int32 LastSampleTick = INDEX_NONE;
+
+	// 띄운 고스트(생성 순서)
+	TArray<TWeakObjectPtr<ASkullyGhost>> Ghosts;
+};
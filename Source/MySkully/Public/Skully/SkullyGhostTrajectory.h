@@ -0,0 +1,126 @@
+/*
+ * 파일명: SkullyGhostTrajectory.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 고스트 레이스용 궤적 파일 형식(양자화 + 키 축약 + varint 델타 청크 스트림)과 스트리밍 쓰기/읽기
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ESkullyMovementMode;
+
+// 궤적의 한 키(양자화된 값에서 복원)
+struct FSkullyGhostKey
+{
+	// 녹화 시작 이후 샘플 번호(시간 = Tick / SampleRate)
+	int32 Tick = 0;
+	FVector Location = FVector::ZeroVector;
+	// ESkullyMovementMode 값
+	uint8 Mode = 0;
+};
+
+/**
+ * 고스트 궤적 쓰기
+ * 파일 형식(리틀 엔디언): 헤더(Magic, Version, SampleRate, BodyRadius) + 청크 반복 + 끝 표시(키 수 0)
+ *   청크: uint16 키 수, uint16 바이트 수, 키 데이터
+ *   키: varint Tick 차이, zigzag varint 위치 차이 3개(0.1cm 단위), uint8 이동 모드
+ *   청크 첫 키는 0 기준 차이(= 절대값)라서 청크마다 독립적으로 디코드된다.
+ * 회전은 기록하지 않는다. 구 루트는 회전하지 않고 구르기는 비주얼 전용(이동 경로로 계산)이라 재생 쪽에서 경로로 다시 계산한다.
+ * 샘플은 추가할 때 바로 양자화하고, 직전 키에서 현재 샘플까지 직선 보간으로 사이 샘플이
+ * 허용 오차 안에 들어오면 키를 만들지 않는다(이동 모드가 바뀌면 항상 키).
+ * 청크가 차면 바로 파일에 써서 녹화 길이와 상관없이 메모리는 청크 하나 + 보류 샘플만 쓴다.
+ */
+class MYSKULLY_API FSkullyGhostWriter
+{
+public:
+	~FSkullyGhostWriter();
+
+	bool Open(const FString& FilePath, float InSampleRate, float InBodyRadius, float InPositionTolerance);
+	// 남은 키와 끝 표시를 쓰고 파일을 닫음
+	bool Close();
+
+	bool IsOpen() const { return FileWriter.IsValid(); }
+
+	// Tick번째 샘플 추가(Tick은 증가해야 하며 건너뛸 수 있음)
+	void AddSample(int32 Tick, const FVector& Location, ESkullyMovementMode Mode);
+
+	int32 GetNumSamples() const { return NumSamples; }
+	int32 GetNumKeys() const { return NumKeys; }
+	int64 GetNumBytes() const { return NumBytes; }
+	float GetSampleRate() const { return SampleRate; }
+
+	// 파일 이름만 주면 Saved/SkullyGhost/<이름>.skghost 경로로 변환
+	static FString ResolveFilePath(const FString& NameOrPath);
+
+private:
+	// 양자화된 샘플
+	struct FQuantizedSample
+	{
+		int32 Tick = 0;
+		FIntVector Location = FIntVector::ZeroValue;
+		uint8 Mode = 0;
+	};
+
+	// Anchor -> Candidate 직선 보간으로 보류 샘플이 모두 허용 오차 안인지
+	bool FitsSegment(const FQuantizedSample& Candidate) const;
+	void EmitKey(const FQuantizedSample& Key);
+	void FlushChunk();
+
+private:
+	TUniquePtr<FArchive> FileWriter;
+	float SampleRate = 30.0f;
+	float PositionToleranceSquared = 0.0f;
+
+	// 마지막 키와 그 뒤로 아직 키가 되지 않은 샘플
+	FQuantizedSample Anchor;
+	bool bHasAnchor = false;
+	TArray<FQuantizedSample> PendingSamples;
+
+	// 현재 청크(델타 기준은 청크 안의 직전 키)
+	TArray<uint8> ChunkBuffer;
+	int32 ChunkKeys = 0;
+	FQuantizedSample ChunkPrevKey;
+
+	int32 NumSamples = 0;
+	int32 NumKeys = 0;
+	int64 NumBytes = 0;
+};
+
+/**
+ * 고스트 궤적 읽기
+ * 파일은 열어 둔 채 청크 하나씩만 읽어 키를 차례로 디코드하므로 재생 길이와 상관없이 메모리가 일정하다.
+ */
+class MYSKULLY_API FSkullyGhostReader
+{
+public:
+	bool Open(const FString& FilePath);
+	void Close();
+
+	bool IsOpen() const { return FileReader.IsValid(); }
+
+	// 다음 키 디코드, 파일 끝이거나 손상됐으면 false
+	bool ReadKey(FSkullyGhostKey& OutKey);
+
+	float GetSampleRate() const { return SampleRate; }
+	float GetBodyRadius() const { return BodyRadius; }
+
+private:
+	bool ReadChunk();
+
+private:
+	TUniquePtr<FArchive> FileReader;
+	float SampleRate = 30.0f;
+	float BodyRadius = 0.0f;
+
+	// 현재 청크와 디코드 위치
+	TArray<uint8> ChunkBuffer;
+	int32 ChunkOffset = 0;
+	int32 ChunkKeysLeft = 0;
+
+	// 청크 안의 직전 키(양자화 값)
+	int32 PrevTick = 0;
+	FIntVector PrevLocation = FIntVector::ZeroValue;
+	bool bEnded = false;
+};
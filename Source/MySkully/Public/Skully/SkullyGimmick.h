@@ -0,0 +1,61 @@
+/*
+ * 파일명: SkullyGimmick.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 맵 기믹의 기반 액터(트리거 볼륨을 기믹 서브시스템 격자에 등록하고 진입/이탈 이벤트만 받음, 되감기 상태 기록)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SkullyGimmick.generated.h"
+
+class UBoxComponent;
+class USkullyMovementComponent;
+
+/**
+ * 기믹 기반 액터
+ * Tick과 오버랩 이벤트를 쓰지 않는다. BeginPlay에서 트리거 볼륨 범위를 USkullyGimmickSubsystem 격자에 등록해 두면,
+ * Skully가 같은 격자 칸에 있을 때만 서브시스템이 포함 여부를 검사해 OnSkullyEnter/OnSkullyExit를 호출한다.
+ * 트리거 볼륨을 움직였으면 RefreshTrigger로 격자 등록을 갱신한다.
+ */
+UCLASS(Abstract)
+class MYSKULLY_API ASkullyGimmick : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASkullyGimmick();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	// 트리거 볼륨 월드 범위(격자 등록용)
+	FBox GetTriggerBounds() const;
+	
+	// 반지름 Radius인 구(중심 Location)가 트리거 볼륨과 겹치는지
+	virtual bool IsInsideTrigger(const FVector& Location, float Radius) const;
+	
+	// 트리거 볼륨을 옮긴 뒤 격자 등록 갱신
+	UFUNCTION(BlueprintCallable, Category = "Gimmick")
+	void RefreshTrigger();
+	
+	// 되감기/체크포인트용 상태 직렬화(기본은 액터 트랜스폼, 상태가 더 있는 기믹은 Super 호출 뒤 이어서 직렬화)
+	virtual void SerializeRewindState(FArchive& Ar);
+	
+	// Skully가 트리거 볼륨에 들어옴/나감
+	UFUNCTION(BlueprintNativeEvent, Category = "Gimmick")
+	void OnSkullyEnter(USkullyMovementComponent* Body);
+	UFUNCTION(BlueprintNativeEvent, Category = "Gimmick")
+	void OnSkullyExit(USkullyMovementComponent* Body);
+	
+	UBoxComponent* GetTriggerVolume() const { return TriggerVolume; }
+
+protected:
+	// 트리거 볼륨(충돌은 끄고 범위만 사용)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Gimmick")
+	UBoxComponent* TriggerVolume;
+};
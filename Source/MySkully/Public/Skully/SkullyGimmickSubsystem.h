@@ -0,0 +1,89 @@
+/*
+ * 파일명: SkullyGimmickSubsystem.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 기믹 트리거 볼륨의 균일 격자 공간 해시와 Skully 진입/이탈 판정
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SkullyGimmickSubsystem.generated.h"
+
+class ASkullyGimmick;
+class USkullyMovementComponent;
+
+/**
+ * 기믹 공간 해시
+ * 기믹은 트리거 볼륨 범위(+ 몸체 여유)가 겹치는 XY 격자 칸마다 등록된다.
+ * 이동 컴포넌트는 격자 칸이 바뀔 때만 NotifyBodyCellChanged로 알리고,
+ * Tick은 기믹이 있는 칸에 있거나 아직 기믹 안에 있는 몸체만 그 칸의 기믹과 포함 여부를 비교한다.
+ * 주변에 Skully가 없는 기믹과 기믹이 없는 칸을 지나는 Skully는 매 프레임 비용이 없다.
+ */
+UCLASS()
+class MYSKULLY_API USkullyGimmickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 격자 칸 크기(cm)
+	static constexpr float CellSize = 2000.0f;
+	// 등록 범위에 더하는 몸체 여유(cm, 몸체 중심 칸만 검사해도 칸 경계 근처 기믹을 놓치지 않도록)
+	static constexpr float BodyMargin = 200.0f;
+	
+	static FIntPoint GetCellCoord(const FVector& Location);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 기믹 등록/해제/범위 갱신
+	void RegisterGimmick(ASkullyGimmick* Gimmick);
+	void UnregisterGimmick(ASkullyGimmick* Gimmick);
+	void UpdateGimmick(ASkullyGimmick* Gimmick);
+	
+	// 몸체의 격자 칸이 바뀜(처음 등록 포함)
+	void NotifyBodyCellChanged(USkullyMovementComponent* Body, const FIntPoint& NewCell);
+	// 몸체 제거(안에 있던 기믹에 이탈 이벤트)
+	void RemoveBody(USkullyMovementComponent* Body);
+
+private:
+	struct FGimmickEntry
+	{
+		TWeakObjectPtr<ASkullyGimmick> Gimmick;
+		// 등록된 격자 범위(최소/최대 칸, 포함)
+		FIntPoint MinCell = FIntPoint::ZeroValue;
+		FIntPoint MaxCell = FIntPoint::ZeroValue;
+	};
+	
+	using FGimmickEvent = TPair<TWeakObjectPtr<ASkullyGimmick>, TWeakObjectPtr<USkullyMovementComponent>>;
+	
+	struct FBodyEntry
+	{
+		TWeakObjectPtr<USkullyMovementComponent> Body;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		// 매 틱 검사 대상(NeedsEvaluation 결과)
+		bool bActive = false;
+		// 현재 안에 있는 기믹
+		TArray<TWeakObjectPtr<ASkullyGimmick>> Inside;
+	};
+	
+	// 기믹을 범위 안 격자 칸에 추가/제거
+	void AddToCells(ASkullyGimmick* Gimmick, const FIntPoint& MinCell, const FIntPoint& MaxCell);
+	void RemoveFromCells(ASkullyGimmick* Gimmick, const FIntPoint& MinCell, const FIntPoint& MaxCell);
+	// 검사가 필요한 몸체인지(기믹이 있는 칸이거나 아직 기믹 안에 있음)
+	bool NeedsEvaluation(const FBodyEntry& Entry) const;
+	// 모든 몸체의 검사 대상 여부 다시 계산(기믹 등록/해제/이동 후)
+	void RefreshActiveBodies();
+	// 한 몸체의 진입/이탈 판정(이벤트는 모아서 Tick 끝에 호출)
+	void EvaluateBody(FBodyEntry& Entry, TArray<FGimmickEvent>& OutEnters, TArray<FGimmickEvent>& OutExits);
+
+private:
+	// 격자 칸 -> 그 칸과 겹치는 기믹
+	TMap<FIntPoint, TArray<TWeakObjectPtr<ASkullyGimmick>>> Cells;
+	TMap<TObjectKey<ASkullyGimmick>, FGimmickEntry> Gimmicks;
+	
+	TArray<FBodyEntry> Bodies;
+};
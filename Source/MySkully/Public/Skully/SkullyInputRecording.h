@@ -0,0 +1,95 @@
+/*
+ * 파일명: SkullyInputRecording.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 입력 녹화/재생(틱 단위 양자화 입력 스트림과 재생 드라이버)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skully/SkullyMovementNetTypes.h"
+
+// 한 틱의 입력
+struct FSkullyInputFrame
+{
+	// 무브먼트 컴포넌트가 받은 월드 기준 이동 입력(XY, 컨트롤 회전과 입력 스케일이 이미 반영된 값)
+	FVector2D WorldMove = FVector2D::ZeroVector;
+	// 이 틱이 끝났을 때의 컨트롤 회전(카메라 복원용, Yaw/Pitch)
+	FRotator ControlRotation = FRotator::ZeroRotator;
+	// 이 틱의 시간 간격(초)
+	float DeltaTime = 0.0f;
+};
+
+namespace SkullyInput
+{
+	// 컨트롤 회전(Yaw)을 기준으로 이동 입력을 월드 방향 입력으로 변환(ASkully::Move와 동일한 계산)
+	MYSKULLY_API FVector ToWorldMoveInput(const FVector2D& MoveInput, const FRotator& ControlRotation);
+}
+
+/**
+ * 틱 단위 입력 스트림
+ * 파일 형식(리틀 엔디언): 헤더(Magic, Version, 프레임 수, 시작 이동 상태, 시작 컨트롤 회전) + 프레임당 16바이트
+ *   float WorldMoveX, float WorldMoveY: 월드 기준 이동 입력(실제 이동에 쓴 값 그대로)
+ *   uint16 ControlYaw, uint16 ControlPitch: 16비트 각도(카메라만 복원하므로 양자화)
+ *   float DeltaTime
+ * 이동에 영향을 주는 값(입력, DeltaTime, 시작 상태)은 양자화하지 않으므로, 같은 지점에서 시작하지 않았거나
+ * 레거시 입력 스케일/마우스 감도가 달라도 녹화할 때와 같은 이동을 재생한다.
+ */
+class MYSKULLY_API FSkullyInputStream
+{
+public:
+	// 프레임 추가(양자화된 값으로 저장)
+	void AddFrame(const FSkullyInputFrame& Frame);
+
+	void Reset() { Frames.Reset(); }
+	
+	// 녹화 시작 시점의 이동 상태와 컨트롤 회전(재생 시작 시 복원)
+	void SetInitialState(const FSkullyMovementSnapshot& InState, const FRotator& InControlRotation);
+	const FSkullyMovementSnapshot& GetInitialState() const { return InitialState; }
+	const FRotator& GetInitialControlRotation() const { return InitialControlRotation; }
+
+	int32 Num() const { return Frames.Num(); }
+	const FSkullyInputFrame& operator[](int32 Index) const { return Frames[Index]; }
+
+	// 전체 재생 시간(초)
+	float GetDuration() const;
+
+	bool SaveToFile(const FString& FilePath) const;
+	bool LoadFromFile(const FString& FilePath);
+
+	// 파일 이름만 주면 Saved/SkullyInput/<이름>.skinput 경로로 변환
+	static FString ResolveFilePath(const FString& NameOrPath);
+
+private:
+	// 프레임 직렬화(읽기/쓰기 공용, 컨트롤 회전은 양자화)
+	static void SerializeFrame(FArchive& Ar, FSkullyInputFrame& Frame);
+	static void SerializeInitialState(FArchive& Ar, FSkullyMovementSnapshot& State, FRotator& ControlRotation);
+
+private:
+	TArray<FSkullyInputFrame> Frames;
+	FSkullyMovementSnapshot InitialState;
+	FRotator InitialControlRotation = FRotator::ZeroRotator;
+};
+
+/**
+ * 입력 스트림 재생 드라이버
+ * 녹화된 월드 기준 이동 입력과 DeltaTime을 그대로 USkullyMovementComponent에 직접 넣는다.
+ * 플레이어 컨트롤러/입력 시스템의 틱 순서나 입력 스케일에 영향을 받지 않으므로, 시작 상태를 복원하면 같은 스트림은 항상 같은 결과를 낸다.
+ */
+class MYSKULLY_API FSkullyInputReplayer
+{
+public:
+	void Start(const FSkullyInputStream& InStream);
+	void Stop();
+
+	bool IsPlaying() const { return bPlaying; }
+
+	// 다음 프레임을 꺼내 월드 입력/시간 간격/컨트롤 회전을 계산, 스트림이 끝나면 false
+	bool Next(FVector& OutWorldInput, float& OutDeltaTime, FRotator& OutControlRotation);
+
+private:
+	FSkullyInputStream Stream;
+	int32 FrameIndex = 0;
+	bool bPlaying = false;
+};
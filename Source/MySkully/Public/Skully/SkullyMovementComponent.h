@@ -4,6 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PawnMovementComponent.h"
+#include "Skully/SkullyDownhillSampler.h"
+#include "Skully/SkullyMovementKernel.h"
+#include "Skully/SkullyMovementModel.h"
+#include "Skully/SkullyMovementNetTypes.h"
+#include "Skully/SkullyMovementStateCodec.h"
+#include "Skully/SkullySurfaceResponse.h"
 #include "SkullyMovementComponent.generated.h"
 
 enum class ESkullyMovementMode
@@ -12,6 +18,125 @@ enum class ESkullyMovementMode
 	Falling
 };
 
+// 바닥 감지 정밀도
+UENUM(BlueprintType)
+enum class ESkullyGroundProbeFidelity : uint8
+{
+	// 단순 충돌(Simple)만 사용
+	Simple,
+	// 단순 충돌로 먼저 감지하고 엣지/꼭짓점 등 애매한 경우만 삼각형 기반(Complex)으로 재확인
+	Adaptive,
+	// 항상 삼각형 기반(Complex) 사용
+	Complex
+};
+
+// 구르는 비주얼 적용 방식
+UENUM(BlueprintType)
+enum class ESkullyRollingVisualMode : uint8
+{
+	// 구르지 않음(보간 오프셋만 적용)
+	None,
+	// 보간 오프셋과 구르기 회전을 프레임 끝에 비주얼마다 한 번의 트랜스폼 갱신으로 적용
+	Transform,
+	// 구르기 회전은 커스텀 프리미티브 데이터로 넘기고 머티리얼 WPO로 회전(트랜스폼 갱신 없음)
+	CustomPrimitiveData
+};
+
+// 서브스텝 보간 오프셋/구르기 회전을 적용할 비주얼 컴포넌트(메시)와 원래 상대 트랜스폼
+struct FSkullyInterpolatedVisual
+{
+	TWeakObjectPtr<USceneComponent> Component;
+	FVector BaseRelativeLocation = FVector::ZeroVector;
+	FQuat BaseRelativeRotation = FQuat::Identity;
+	// 컴포넌트 로컬 공간의 구 중심(커스텀 프리미티브 데이터 회전 기준점)
+	FVector LocalPivot = FVector::ZeroVector;
+};
+
+// 누적 씬 쿼리 수(벤치마크/프로파일링용, stat 카운터와 달리 프레임마다 초기화되지 않음)
+struct FSkullyMovementQueryCounters
+{
+	// 이동 Sweep(SafeMoveUpdatedComponent, SlideAlongSurface, 2-pass 재투영, 다중 반복 스윕)
+	uint32 MoveSweeps = 0;
+	// 바닥 Sphere Sweep
+	uint32 GroundSweeps = 0;
+	// 바닥 라인트레이스(보조 감지 + downhill 샘플)
+	uint32 GroundLineTraces = 0;
+	
+	uint32 GetTotal() const
+	{
+		return MoveSweeps + GroundSweeps + GroundLineTraces;
+	}
+};
+
+// 바닥 쿼리 캐시 키: 쿼리를 실행한 위치/반지름/스텝
+struct FSkullyGroundQueryKey
+{
+	FVector Location = FVector::ZeroVector;
+	float Radius = 0.0f;
+	uint32 StepId = 0;
+	bool bValid = false;
+	// Static 지오메트리에 대한 결과인지(스텝이 바뀌어도 재사용 가능)
+	bool bStatic = false;
+	
+	// 같은 위치(Tolerance 이내)/반지름의 쿼리이고, 같은 스텝이거나 Static 결과면 재사용 가능
+	bool Matches(const FVector& InLocation, float InRadius, uint32 InStepId, float Tolerance) const
+	{
+		if (bValid == false || FMath::IsNearlyEqual(Radius, InRadius) == false)
+		{
+			return false;
+		}
+		
+		if (StepId != InStepId && bStatic == false)
+		{
+			return false;
+		}
+		
+		return FVector::DistSquared(Location, InLocation) <= FMath::Square(Tolerance);
+	}
+	
+	void Set(const FVector& InLocation, float InRadius, uint32 InStepId, bool bInStatic)
+	{
+		Location = InLocation;
+		Radius = InRadius;
+		StepId = InStepId;
+		bStatic = bInStatic;
+		bValid = true;
+	}
+};
+
+// 바닥 쿼리(SweepGround, 보조 라인트레이스, downhill 샘플) 결과 캐시
+// 슬라이드/이동/지면 판정 단계에서 같은 바닥 정보를 재사용하고, Static 바닥 위에 정지해 있으면 쿼리 자체를 생략한다
+struct FSkullyGroundQueryCache
+{
+	// 현재 스텝 번호(SimulateStep마다 증가)
+	uint32 StepId = 0;
+	
+	FSkullyGroundQueryKey SweepKey;
+	FHitResult SweepHit;
+	bool bSweepHit = false;
+	// 움직이는 바닥(MovementBase) 위 스윕 결과: 쿼리 당시 바닥 변환과 바닥 기준 시작 위치
+	// 바닥 기준 상대 위치가 그대로면 바닥이 움직인 만큼 히트를 옮겨서 재사용
+	TWeakObjectPtr<const UPrimitiveComponent> SweepBase;
+	FTransform SweepBaseTransform;
+	FVector SweepBaseLocalStart = FVector::ZeroVector;
+	
+	FSkullyGroundQueryKey LineKey;
+	FHitResult LineHit;
+	bool bLineHit = false;
+	
+	FSkullyGroundQueryKey DownhillKey;
+	FVector DownhillDir = FVector::ZeroVector;
+	bool bDownhillFound = false;
+	
+	void Invalidate()
+	{
+		SweepKey.bValid = false;
+		SweepBase.Reset();
+		LineKey.bValid = false;
+		DownhillKey.bValid = false;
+	}
+};
+
 /**
  * 
  */
@@ -24,8 +149,74 @@ public:
 	USkullyMovementComponent();
 	
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	// 입력이 들어오면 잠든 상태에서 깨어남
+	virtual void AddInputVector(FVector WorldVector, bool bForce = false) override;
+	
+	// 고정 스텝 모드에서 렌더 보간 오프셋을 적용할 비주얼 컴포넌트 등록(UpdatedComponent의 자식이어야 함)
+	UFUNCTION(BlueprintCallable, Category = "Substep")
+	void SetInterpolatedVisualComponents(const TArray<USceneComponent*>& Components);
+	
+	// 외부 드라이버(벤치마크/입력 리플레이)가 입력과 시간 간격을 직접 지정해서 한 프레임 진행
+	void TickWithInput(float DeltaTime, const FVector& WorldInput);
+	
+	// 누적 씬 쿼리 수
+	const FSkullyMovementQueryCounters& GetQueryCounters() const { return QueryCounters; }
+	void ResetQueryCounters() { QueryCounters = FSkullyMovementQueryCounters(); }
+	
+	// 바닥 쿼리 캐시 무효화(텔레포트, 바닥 지오메트리 변경 등 캐시를 믿을 수 없을 때 호출)
+	UFUNCTION(BlueprintCallable, Category = "Ground|Cache")
+	void InvalidateGroundQueryCache();
+	
+	// 속도 변화량(cm/s)을 즉시 더하고 깨움(폭발, 밀치기 등 외부 충격)
+	UFUNCTION(BlueprintCallable, Category = "Sleep")
+	void AddImpulse(const FVector& VelocityChange);
+	
+	// 잠든 상태에서 깨어나 다시 매 틱 시뮬레이션
+	UFUNCTION(BlueprintCallable, Category = "Sleep")
+	void WakeUp();
+	
+	// 바닥 반응 테이블 교체(바닥 프리미티브별 캐시 초기화)
+	UFUNCTION(BlueprintCallable, Category = "Surface")
+	void SetSurfaceResponseTable(USkullySurfaceResponseTable* NewTable);
+	
+	UFUNCTION(BlueprintPure, Category = "Sleep")
+	bool IsAsleep() const { return bIsAsleep; }
+	
+	// 현재 수평 속력/이동 방향(스트리밍 예측 등 외부에서 읽기용)
+	UFUNCTION(BlueprintPure, Category = "Speed")
+	float GetCurrentSpeed2D() const { return CurrentSpeed2D; }
+	UFUNCTION(BlueprintPure, Category = "Speed")
+	FVector GetCurrentMoveDir2D() const { return CurrentMoveDir2D; }
+	// 현재 이동 모드(고스트 기록 등 외부에서 읽기용)
+	ESkullyMovementMode GetMovementMode() const { return MovementMode; }
+	
+	// 되감기/보정용 이동 상태 저장과 복원
+	FSkullyMovementSnapshot CaptureSnapshot() const;
+	void RestoreSnapshot(const FSkullyMovementSnapshot& Snapshot);
+	
+	// 클라이언트 예측 통계(누적)
+	const FSkullyNetPredictionStats& GetNetPredictionStats() const { return NetStats; }
+	void ResetNetPredictionStats() { NetStats = FSkullyNetPredictionStats(); }
+	
+	// 현재 튜닝 값으로 이동 모델 파라미터 생성(배치 시뮬레이터가 같은 모델을 쓰도록 공유)
+	FSkullyMovementModelParams MakeModelParams() const;
 	
 protected:
+	// 입력 소비 이후의 한 프레임 처리(고정 스텝 또는 가변 스텝)
+	void AdvanceFrame(float DeltaTime);
+	// 한 스텝의 물리 처리
+	void SimulateStep(float DeltaTime);
+	// 고정 시간 간격으로 SimulateStep 반복 + 렌더 보간
+	void TickFixedTimestep(float DeltaTime);
+	// 비주얼 컴포넌트에 월드 기준 보간 오프셋 적용(프레임 처리 중에는 프레임 끝까지 미룸)
+	void ApplyVisualOffset(const FVector& WorldOffset);
+	// 수평 속력/방향으로 구르기 회전을 누적하고 비주얼 트랜스폼 적용
+	void UpdateRollingVisual(float DeltaTime);
+	// 보간 오프셋과 구르기 회전이 바뀌었으면 비주얼마다 한 번에 적용
+	void FlushVisualTransforms();
+	
 	// 중력 적용
 	void ApplyGravity(float DeltaTime);
 	// 저항 적용
@@ -33,20 +224,103 @@ protected:
 	// 경사면에서 정지 시 미끄러짐(굴러떨어짐) 적용
 	// 반환값: 이번 프레임 슬라이드 가속을 적용했는지 (슬라이딩 마찰로 전환할지 판단용)
 	bool ApplySlopeSlide(float DeltaTime);
+	// 움직이는 바닥이 지난 스텝 이후 움직인 만큼(이동 + 회전) 따라 이동
+	void ApplyMovementBaseDelta(float DeltaTime);
+	// 지면 판정 결과로 추적할 움직이는 바닥 갱신
+	void UpdateMovementBase();
+	// 움직이는 바닥 위에서 바닥 기준 위치가 그대로면 이전 스윕 결과를 바닥 이동만큼 옮겨서 재사용
+	bool TryReuseBaseRelativeSweep(const FVector& StartPos, float Radius, FHitResult& OutHit) const;
+	// 현재 바닥의 반응(없으면 nullptr)
+	const FSkullySurfaceResponse* FindSurfaceResponse();
+	void FlushSurfaceResponseCache();
 	// 이동 처리
 	void Move(float DeltaTime);
+	// 막힐 때마다 남은 이동을 표면을 따라 다시 스윕(최대 MaxMoveIterations회)
+	void ResolveMove(const FVector& MoveDelta);
 	// 지면 판정
 	void CheckGround(float DeltaTime);
 	// 이동에 관련된 상태값 갱신
 	void UpdateMotionState();
+	// 기믹 격자 칸이 바뀌었으면 USkullyGimmickSubsystem에 알림
+	void UpdateGimmickCell();
 	// 바닥 감지
 	bool SweepGround(FHitResult& OutHit);
+	// 보조 바닥 감지(짧은 아래 라인트레이스)
+	bool LineTraceGround(FHitResult& OutHit);
+	// 주변 바닥 샘플링으로 downhill 방향 추정
+	bool GetDownhillDir(FVector& OutDir);
+	// Static 지오메트리에 대한 히트인지
+	static bool IsStaticHit(const FHitResult& Hit);
+	// 바닥 Sphere Sweep 쿼리 1회
+	bool SweepGroundQuery(FHitResult& OutHit, const FVector& StartPos, const FVector& EndPos, const FCollisionShape& Shape, bool bTraceComplex) const;
+	// 바닥 라인트레이스 쿼리 1회
+	bool LineTraceGroundQuery(FHitResult& OutHit, const FVector& StartPos, const FVector& EndPos, bool bTraceComplex) const;
+	// 단순 충돌 스윕 결과가 애매해서 Complex로 재확인해야 하는지
+	bool IsAmbiguousGroundHit(bool bHit, const FHitResult& Hit) const;
+	// 허용 경사각의 노멀 Z값
+	float GetWalkableFloorZ() const;
 	// 바닥 위치 보정
 	void SnapToGround(const FHitResult& Hit);
 		
 	// 입력 벡터 소비 및 정규화
 	FVector ConsumeMovementInput();
 	
+	// 입력 소비 이후 한 프레임 이동(잠든 상태 처리 포함), TickComponent/TickWithInput/무브 재생이 공유
+	void PerformMove(float DeltaTime, const FVector& Input);
+	
+	// 비동기 물리 모드
+	// 단독 실행에서 bUseAsyncPhysics가 켜져 있으면 true
+	bool ShouldUseAsyncPhysics() const;
+	// 입력/파라미터를 물리 스레드로 넘기고 보간된 결과를 적용(게임 스레드에서는 Sweep 없음)
+	void TickAsyncPhysics(const FVector& Input);
+	// 물리 스레드 바디 제거(모드를 끄거나 EndPlay)
+	void StopAsyncPhysics();
+	// 현재 상태를 물리 스레드 바디 상태로
+	FSkullyKernelBodyState MakeKernelBodyState() const;
+	
+	// 네트워크 역할별 틱
+	// 자율 프록시(입력을 가진 클라이언트): 양자화 입력으로 예측 이동 후 무브 저장/전송
+	void TickAutonomousProxy(float DeltaTime, const FVector& Input);
+	// 시뮬레이티드 프록시(다른 클라이언트의 Skully): 입력 없이 추측 이동, 복제 상태가 오면 보정
+	void TickSimulatedProxy(float DeltaTime);
+	// 서버에서 이동 상태 복제값 갱신
+	void UpdateReplicatedState();
+	// 보정으로 생긴 위치 차이를 메시에서 서서히 줄임
+	void UpdateNetSmoothing(float DeltaTime);
+	// 보정 전후 위치 차이를 메시 스무딩 오프셋에 더함
+	void AddNetSmoothingOffset(const FVector& OldLocation);
+	// 확인받은 시퀀스까지의 저장된 무브 제거
+	void RemoveAckedMoves(uint16 Sequence);
+	
+	// 클라이언트 -> 서버: 새 무브 + 아직 확인받지 못한 이전 무브 일부(손실 대비 중복 전송)
+	// AckedStateSequence: 클라이언트가 마지막으로 받은 보정 상태 시퀀스(서버가 델타 기준으로 사용)
+	UFUNCTION(Server, Unreliable)
+	void ServerMove(const TArray<FSkullyNetInputMove>& Moves, FVector_NetQuantize10 ClientLocation, uint16 AckedStateSequence);
+	// 서버 -> 클라이언트: 해당 시퀀스까지 결과가 일치함
+	UFUNCTION(Client, Unreliable)
+	void ClientAckMove(uint16 Sequence);
+	// 서버 -> 클라이언트: 해당 시퀀스 이후의 서버 상태로 보정(키프레임 또는 받은 상태 기준 델타)
+	UFUNCTION(Client, Unreliable)
+	void ClientAdjustMove(uint16 Sequence, const FSkullyPackedMovementState& ServerState);
+	
+	UFUNCTION()
+	void OnRep_ReplicatedState();
+	
+	// 정지 상태가 SleepDelay 동안 유지되면 잠듦
+	void UpdateSleepState(float DeltaTime);
+	// 잠듦: 틱을 끄거나 SleepTickInterval로 낮추고, 바닥/자신의 이동 감지 시작
+	void GoToSleep();
+	// 잠든 상태의 저주기 틱: 바닥 확인만 하고, 바닥을 잃었으면 깨어남
+	void TickAsleep();
+	// 잠든 동안 감시할 바닥/자신의 트랜스폼 변경 바인딩
+	void BindSleepWatchers();
+	void UnbindSleepWatchers();
+	// 바닥 또는 자신이 외부에서 움직였을 때
+	void OnSleepWatchedTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+	// 바닥 액터가 파괴되었을 때
+	UFUNCTION()
+	void OnSleepFloorActorDestroyed(AActor* DestroyedActor);
+	
 protected:
 	// 중력값
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gravity")
@@ -104,6 +378,21 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slope")
 	float DownhillSampleDistance = 10.0f;
 	
+	// downhill 샘플 방향 수(많을수록 내리막 방향 추정이 정확하나 트레이스 수가 늘어남)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slope")
+	ESkullyDownhillSampleCount DownhillSampleCount = ESkullyDownhillSampleCount::Four;
+	
+	// downhill 샘플을 비동기 배치 트레이스로 처리할지 여부
+	// 켜면 게임 스레드가 트레이스를 기다리지 않으나, 결과는 요청 다음 틱부터 적용됨
+	// 네트워크 플레이에서는 예측/보정 결과가 같도록 항상 동기로 처리
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slope")
+	bool bUseAsyncDownhillSamples = true;
+	
+	// 비동기 샘플 결과를 재사용할 수 있는 최대 위치 변화량(cm)
+	// 요청 이후 이보다 많이 움직였으면 결과를 버리고 다시 요청
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slope", meta = (EditCondition = "bUseAsyncDownhillSamples"))
+	float AsyncDownhillReuseDistance = 5.0f;
+	
 	// downhill 보정이 작동하기 위한 최소 경사 조건
 	// 평지에서는 샘플링 기반 downhill을 쓰면 4방향의 Z 높이가 거의 똑같아 평지에서도 미끄러지는 방향이 생겨버림
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Slope")
@@ -136,7 +425,25 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Stability")
 	float MinProjectedMoveCm = 1.0f;
 	
+// 이동 해결(다중 반복 스윕) 파라미터
+	// 한 스텝 이동에서 막힌 뒤 남은 이동을 다시 스윕하는 최대 횟수(1이면 기존 단일 슬라이드 + 2-pass 재투영)
+	// 늘리면? 빠른 슬라이드가 코너/경사 변화에서 이동량을 덜 잃지만 막힐 때 스윕 비용이 늘어남
+	// 줄이면? 스윕 비용이 줄지만 낮은 프레임레이트에서 남은 이동이 버려져 감속/멈춤이 생김
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move|Resolver", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxMoveIterations = 4;
+	
+	// 한 스텝 이동에서 겹침 해소로 밀어낼 수 있는 최대 거리(cm)
+	// 늘리면? 깊이 끼었을 때도 빠져나오지만 얇은 벽 너머로 튀어나갈 수 있음
+	// 줄이면? 튐은 줄지만 깊이 겹친 상태에서는 그 스텝 이동을 포기함
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Move|Resolver", meta = (ClampMin = "0.0"))
+	float MaxDepenetrationPerMove = 100.0f;
+	
 // SweepGround 파라미터
+	// 바닥 감지 정밀도(Adaptive: 평소엔 단순 충돌, 엣지/꼭짓점처럼 애매할 때만 Complex)
+	// Complex는 렌더 메시 삼각형 단위로 검사하므로 큰 맵에서 이동 비용 대부분을 차지함
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Sweep")
+	ESkullyGroundProbeFidelity GroundProbeFidelity = ESkullyGroundProbeFidelity::Adaptive;
+	
 	// 스컬리의 맨 아래 위치(SphereComponent의 반지름)부터 지면까지의 감지 거리
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Sweep|Stability")
 	float GroundCheckDistance = 10.0f;
@@ -171,6 +478,127 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Movement|Ground")
 	float GroundLineTraceDistance = 12.0f;
 	
+// 고정 스텝(서브스텝) 파라미터
+	// 프레임 시간 대신 고정 시간 간격으로 물리를 적분할지 여부
+	// 켜면 프레임레이트(30/60/144)와 관계없이 같은 결과, 히치 프레임에서도 한 번의 이동량이 제한됨
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Substep")
+	bool bUseFixedTimestep = false;
+	
+	// 서브스텝 1회의 시간 간격(초)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Substep", meta = (ClampMin = "0.001", EditCondition = "bUseFixedTimestep"))
+	float FixedTimestep = 1.0f / 60.0f;
+	
+	// 한 프레임에 실행할 수 있는 최대 서브스텝 수(초과한 시간은 버림)
+	// 늘리면? 느린 프레임에서도 시뮬레이션 시간이 정확하나 히치 프레임의 물리 비용이 커짐
+	// 줄이면? 물리 비용 상한이 낮아지나 느린 프레임에서 움직임이 느려짐
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Substep", meta = (ClampMin = "1", EditCondition = "bUseFixedTimestep"))
+	int32 MaxSubstepsPerFrame = 4;
+	
+	// 렌더 보간을 허용하는 최대 거리(cm), 이보다 멀면 순간이동으로 보고 보간하지 않음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Substep", meta = (EditCondition = "bUseFixedTimestep"))
+	float MaxVisualInterpolationDistance = 500.0f;
+	
+	// 구 이동을 Chaos 비동기 물리 콜백(물리 스레드, p.TickPhysicsAsync면 고정 간격)에서 적분할지 여부
+	// 게임 스레드는 입력 전달과 결과 보간만 하므로 이동 Sweep 비용이 사라지고 프레임레이트와 무관하게 움직임
+	// 물리 스레드 이동은 배치 시뮬레이터와 같은 가벼운 규칙(downhill 샘플링/바닥 반응 테이블/움직이는 바닥 추적/휴면 없음)이고 단독 실행에서만 사용
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Substep|Async")
+	bool bUseAsyncPhysics = false;
+	
+// 구르는 비주얼 파라미터
+	// 비주얼 컴포넌트(SetInterpolatedVisualComponents)를 수평 이동에 맞춰 굴릴 방식
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual|Rolling")
+	ESkullyRollingVisualMode RollingVisualMode = ESkullyRollingVisualMode::Transform;
+	
+	// 구르기 반지름(cm, 0이면 구 콜라이더 반지름)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual|Rolling", meta = (ClampMin = "0.0"))
+	float RollingVisualRadius = 0.0f;
+	
+	// 이보다 작은 회전 변화(도)는 다음 프레임으로 미룸
+	// 늘리면? 느리게 구를 때 트랜스폼 갱신이 줄지만 회전이 뚝뚝 끊겨 보임
+	// 줄이면? 회전이 부드럽지만 거의 멈춘 상태에서도 매 프레임 갱신
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual|Rolling", meta = (ClampMin = "0.0"))
+	float MinRollUpdateDegrees = 0.25f;
+	
+	// CustomPrimitiveData 모드에서 쓰는 커스텀 프리미티브 데이터 시작 인덱스
+	// [Index, Index + 3]: 컴포넌트 로컬 공간 회전 쿼터니언, [Index + 4, Index + 6]: 로컬 공간 회전 기준점(구 중심)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual|Rolling", meta = (ClampMin = "0", EditCondition = "RollingVisualMode == ESkullyRollingVisualMode::CustomPrimitiveData"))
+	int32 RollCustomDataIndex = 0;
+	
+// 바닥 쿼리 캐시 파라미터
+	// 바닥 쿼리 결과 재사용 여부
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Cache")
+	bool bUseGroundQueryCache = true;
+	
+	// 캐시를 재사용할 수 있는 최대 위치 변화량(cm)
+	// 늘리면? 쿼리가 더 자주 생략되나 바닥 거리/노멀 오차가 커짐
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Cache", meta = (ClampMin = "0.0"))
+	float GroundQueryCacheTolerance = 0.05f;
+	
+// 바닥 격자 파라미터
+	// 맵에 구워 둔 바닥 격자(USkullyWalkabilityField)가 있으면 바닥 Sweep 전에 먼저 조회할지 여부
+	// 발밑이 구워진 평면이고 주변에 움직이는 프리미티브가 없으면 스윕 없이 바닥을 확정, 그 외에는 기존 씬 쿼리
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Walkability")
+	bool bUseWalkabilityField = true;
+	
+// 네트워크 예측 파라미터
+	// 서버 결과와 클라이언트 예측 위치 차이가 이보다 크면 보정(cm)
+	// 늘리면? 보정 RPC가 줄지만 작은 오차가 쌓임
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+	float NetCorrectionThreshold = 2.0f;
+	
+	// 보정 후 메시가 실제 위치를 따라잡는 시간(초)
+	// 늘리면? 보정이 더 부드럽지만 메시와 충돌체의 어긋남이 오래 보임
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+	float NetSmoothingTime = 0.1f;
+	
+	// 이보다 큰 보정은 스무딩 없이 바로 이동(cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0.0"))
+	float NetMaxSmoothingDistance = 300.0f;
+	
+	// 무브마다 함께 다시 보낼 확인받지 못한 이전 무브 수(Unreliable RPC 손실 대비)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0", ClampMax = "8"))
+	int32 NetRedundantMoves = 2;
+	
+	// 클라이언트가 보관하는 최대 무브 수(넘으면 가장 오래된 무브부터 버림)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "8"))
+	int32 MaxSavedMoves = 96;
+	
+// 휴면(Sleep) 파라미터
+	// 정지 상태가 유지되면 틱을 끄거나 낮춰서 유휴 비용을 줄일지 여부
+	// 네트워크 플레이(리슨/데디케이티드 서버, 클라이언트)에서는 예측/보정과 어긋나지 않도록 잠들지 않음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sleep")
+	bool bEnableSleep = true;
+	
+	// 정지로 보는 최대 속력(cm/s)
+	// 늘리면? 더 빨리 잠들지만 느리게 구르던 몸이 뚝 멈출 수 있음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sleep", meta = (ClampMin = "0.0", EditCondition = "bEnableSleep"))
+	float SleepVelocityThreshold = 1.0f;
+	
+	// 정지 상태가 이 시간(초) 이상 유지되어야 잠듦
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sleep", meta = (ClampMin = "0.0", EditCondition = "bEnableSleep"))
+	float SleepDelay = 0.5f;
+	
+	// 잠든 동안의 틱 간격(초), 0이면 틱을 완전히 끄고 입력/충격/바닥 이동 이벤트로만 깨어남
+	// 0보다 크면 그 간격으로 바닥 확인만 해서, 이벤트가 없는 바닥 변화(예: 물리로 밀린 바닥)도 감지
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sleep", meta = (ClampMin = "0.0", EditCondition = "bEnableSleep"))
+	float SleepTickInterval = 0.0f;
+	
+// 움직이는 바닥 파라미터
+	// Movable 바닥 위에 있으면 바닥의 이동/회전을 먼저 따라간 뒤 이동(충돌로 밀리거나 겹침 해소를 반복하지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Base")
+	bool bTrackMovingBase = true;
+	
+	// 움직이는 바닥에서 떨어질 때 바닥 속도를 이어받을지 여부
+	// 끄면 바닥 끝에서 떨어질 때 바닥 이동 방향의 관성이 사라져 제자리에서 떨어지는 느낌이 남
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground|Base", meta = (EditCondition = "bTrackMovingBase"))
+	bool bImpartBaseVelocityOnLeave = true;
+	
+// 바닥 반응 파라미터
+	// 바닥 물리 머티리얼별 마찰/슬라이드 감쇠/정지 임계치/최대 슬라이드 속도 테이블
+	// 비어 있거나 테이블에 없는 머티리얼이면 이 컴포넌트의 값을 그대로 사용
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Surface")
+	TObjectPtr<USkullySurfaceResponseTable> SurfaceResponseTable;
+	
 private:
 	// 움직임 상태값
 	ESkullyMovementMode MovementMode = ESkullyMovementMode::Falling;
@@ -190,6 +618,126 @@ private:
 	// 현재 스윕 히트
 	FHitResult CurrentFloorHit;
 	
+	// 추적 중인 움직이는 바닥과 마지막으로 따라간 시점의 바닥 변환/속도
+	TWeakObjectPtr<UPrimitiveComponent> MovementBase;
+	FTransform LastBaseTransform;
+	FVector MovementBaseVelocity = FVector::ZeroVector;
+	// 바닥 변환이 마지막으로 바뀐 뒤 흐른 시뮬레이션 시간과 그 프레임
+	// 바닥은 프레임에 한 번 움직이므로 서브스텝 하나의 dt가 아니라 이 시간으로 바닥 속도를 구함
+	float BaseElapsedTime = 0.0f;
+	uint64 LastBaseMoveFrame = 0;
+	// 이번 스텝에 바닥이 움직였는지(움직이는 바닥 위에서는 잠들지 않음)
+	bool bBaseMovedThisStep = false;
+	
+	// 바닥 프리미티브별 반응 캐시(테이블에 없으면 nullptr), 바닥이 바뀔 때만 조회
+	// 테이블 내부 포인터가 아닌 사본을 보관(에셋 수정/TMap 재해시에도 안전), 테이블 변경 카운터가 바뀌면 비움
+	TMap<TObjectKey<UPrimitiveComponent>, TOptional<FSkullySurfaceResponse>> SurfaceResponseCache;
+	TObjectKey<UPrimitiveComponent> SurfaceFloorKey;
+	TOptional<FSkullySurfaceResponse> CurrentSurfaceResponse;
+	uint32 SurfaceResponseTableChangeCounter = 0;
+	
 	// 슬라이딩 플래그
 	bool bIsSlopeSliding = false;
+	
+	// 이번 프레임에 소비한 입력 벡터
+	FVector FrameInput = FVector::ZeroVector;
+	// 서브스텝이 돌지 않은 프레임에 소비한 입력(다음 서브스텝까지 보관)
+	FVector UnappliedInput = FVector::ZeroVector;
+	
+	// 고정 스텝 누적 시간
+	float TimeAccumulator = 0.0f;
+	
+	// 마지막 서브스텝 직전의 위치(렌더 보간 기준)
+	FVector PreviousStepLocation = FVector::ZeroVector;
+	
+	// 현재 적용 중인 월드 기준 보간 오프셋
+	FVector VisualOffset = FVector::ZeroVector;
+	
+	// 고정 스텝 렌더 보간 오프셋(VisualOffset = InterpolationOffset + NetSmoothingOffset)
+	FVector InterpolationOffset = FVector::ZeroVector;
+	
+	// 네트워크 보정 스무딩 오프셋
+	FVector NetSmoothingOffset = FVector::ZeroVector;
+	
+	// 보간 오프셋을 적용할 비주얼 컴포넌트
+	TArray<FSkullyInterpolatedVisual> InterpolatedVisuals;
+	
+	// 누적 구르기 회전(월드 기준)과 비주얼에 적용된 회전
+	FQuat RollRotation = FQuat::Identity;
+	FQuat AppliedRollRotation = FQuat::Identity;
+	
+	// 프레임 처리 중(이동이 끝난 뒤 비주얼 트랜스폼을 한 번에 적용)
+	bool bDeferVisualUpdate = false;
+	
+	// 바닥 쿼리 캐시
+	FSkullyGroundQueryCache GroundQueryCache;
+	
+	// downhill 방향 샘플러
+	FSkullyDownhillSampler DownhillSampler;
+	
+	// 누적 씬 쿼리 수(const 쿼리 함수에서도 셈)
+	mutable FSkullyMovementQueryCounters QueryCounters;
+	
+	// MaxSlopeAngle로 계산한 노멀 Z(각도가 바뀔 때만 다시 계산)
+	mutable float CachedWalkableFloorZ = 0.0f;
+	mutable float CachedWalkableSlopeAngle = -1.0f;
+	
+	// 비동기 물리 모드의 바디 ID(USkullyAsyncMovementSubsystem)
+	int32 AsyncBodyId = INDEX_NONE;
+	
+	// 마지막으로 알린 기믹 격자 칸
+	FIntPoint GimmickCell = FIntPoint::ZeroValue;
+	bool bHasGimmickCell = false;
+	
+	// 서버 보정 후 저장된 무브를 다시 시뮬레이션하는 중(기믹 알림/비주얼 적용을 건너뜀)
+	bool bIsReplayingMoves = false;
+	
+	// 이번 스텝의 이동 모델 파라미터(SimulateStep 시작 시 갱신)
+	FSkullyMovementModelParams StepModelParams;
+	
+	// 시뮬레이티드 프록시에 복제할 서버 이동 상태
+	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedState)
+	FSkullyMovementSnapshot ReplicatedState;
+	
+	// 클라이언트: 다음 무브 시퀀스, 확인받지 못한 무브, 마지막으로 확인받은 시퀀스
+	uint16 NextMoveSequence = 1;
+	TArray<FSkullySavedMove> SavedMoves;
+	uint16 LastAckedSequence = 0;
+	
+	// 클라이언트: 받은 보정 상태(델타 복원 기준)와 마지막으로 받은 보정 상태 시퀀스
+	FSkullyMovementStateHistory ReceivedStates;
+	uint16 LastReceivedStateSequence = 0;
+	
+	// 서버: 마지막으로 처리한 클라이언트 무브 시퀀스
+	uint16 LastProcessedSequence = 0;
+	
+	// 서버: 보낸 보정 상태(양자화 후 값)와 마지막 키프레임 이후 보낸 델타 수
+	FSkullyMovementStateHistory SentStates;
+	int32 DeltaStatesSinceKeyframe = 0;
+	
+	// 시뮬레이티드 프록시: 복제된 마지막 입력
+	FVector ProxyInput = FVector::ZeroVector;
+	
+	// 클라이언트 예측 통계
+	FSkullyNetPredictionStats NetStats;
+	
+	// 잠든 상태인지
+	bool bIsAsleep = false;
+	
+	// 정지 상태가 유지된 시간
+	float RestTime = 0.0f;
+	
+	// 정지 상태를 판정할 때의 바닥(바닥이 바뀌면 정지 시간을 다시 잼)
+	TWeakObjectPtr<UPrimitiveComponent> RestFloorComponent;
+	
+	// 잠들 때 틱을 직접 껐는지(외부 드라이버가 틱을 끈 경우에는 깨어나도 켜지 않음)
+	bool bSleepDisabledTick = false;
+	
+	// 잠들기 전 틱 간격
+	float AwakeTickInterval = 0.0f;
+	
+	// 잠든 동안 감시 중인 컴포넌트와 바인딩 핸들
+	TWeakObjectPtr<USceneComponent> SleepWatchedFloor;
+	FDelegateHandle SleepFloorTransformHandle;
+	FDelegateHandle SleepSelfTransformHandle;
 };
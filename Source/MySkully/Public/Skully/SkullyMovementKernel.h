@@ -0,0 +1,88 @@
+/*
+ * 파일명: SkullyMovementKernel.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 배치 스텝용 이동 모델 커널(중력/경사 투영/정지·운동 마찰/속도 제한)의 스칼라 경로와 4-wide SIMD(float) 경로,
+ *       컴포넌트 없이 구 하나를 스윕 이동 + 지면 판정하는 단계(배치 시뮬레이터/비동기 물리 스텝 공유)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/HitResult.h"
+#include "Skully/SkullyMovementModel.h"
+
+/**
+ * 바디 4개 묶음의 속도 단계 입력/출력(SoA, float)
+ * 바디 수가 4의 배수가 아니면 남는 레인은 ClearLane으로 비워 둔다(결과는 버림).
+ */
+struct MYSKULLY_API FSkullyMovementKernelLanes
+{
+	static constexpr int32 Width = 4;
+
+	alignas(16) float VelocityX[Width];
+	alignas(16) float VelocityY[Width];
+	alignas(16) float VelocityZ[Width];
+	alignas(16) float CachedNormalX[Width];
+	alignas(16) float CachedNormalY[Width];
+	alignas(16) float CachedNormalZ[Width];
+	alignas(16) float LastNormalX[Width];
+	alignas(16) float LastNormalY[Width];
+	alignas(16) float LastNormalZ[Width];
+	// 정규화된 입력 방향(입력이 없으면 0)
+	alignas(16) float InputDirX[Width];
+	alignas(16) float InputDirY[Width];
+	// 0 또는 1
+	alignas(16) float Grounded[Width];
+	alignas(16) float HasInput[Width];
+	alignas(16) float Sliding[Width];
+
+	// 출력: 이번 스텝 이동량(Grounded면 바닥 평면 투영)
+	alignas(16) float MoveX[Width];
+	alignas(16) float MoveY[Width];
+	alignas(16) float MoveZ[Width];
+
+	void SetLane(int32 Lane, const FVector& Velocity, const FVector& CachedFloorNormal, const FVector& LastFloorNormal, const FVector& Input, bool bGrounded, bool bIsSlopeSliding);
+	void ClearLane(int32 Lane);
+
+	FVector GetVelocity(int32 Lane) const { return FVector(VelocityX[Lane], VelocityY[Lane], VelocityZ[Lane]); }
+	FVector GetMoveDelta(int32 Lane) const { return FVector(MoveX[Lane], MoveY[Lane], MoveZ[Lane]); }
+	bool IsSliding(int32 Lane) const { return Sliding[Lane] > 0.0f; }
+};
+
+// 컴포넌트 없이 스텝하는 구 하나의 이동 상태
+struct FSkullyKernelBodyState
+{
+	FVector Position = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+	FVector CachedFloorNormal = FVector::UpVector;
+	FVector LastFloorNormal = FVector::UpVector;
+	bool bGrounded = false;
+	bool bIsSlopeSliding = false;
+};
+
+// 구 Sweep 한 번(Start -> End, 막히면 true), 호출하는 쪽 스레드에 맞는 씬 쿼리를 넘긴다
+using FSkullyKernelSweepFunction = TFunctionRef<bool(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel)>;
+
+namespace SkullyMovementKernel
+{
+	/**
+	 * 바디 한 개의 속도 단계(스칼라, SkullyMovementModel 함수 사용): 중력 -> 경사 미끄러짐 -> 마찰 -> 입력 가속 -> 이동량
+	 * 노멀이 애매해서 경사 성분이 0이면 downhill 샘플링 없이 슬라이드를 끊는다(배치 시뮬레이터 규칙).
+	 */
+	MYSKULLY_API void StepVelocity(FVector& Velocity, bool& bIsSlopeSliding, const FVector& CachedFloorNormal, const FVector& LastFloorNormal,
+		const FVector& Input, bool bGrounded, const FSkullyMovementModelParams& Params, float DeltaTime, FVector& OutMoveDelta);
+
+	// 레인마다 StepVelocity를 실행(SIMD 경로 검증 기준)
+	MYSKULLY_API void StepVelocitiesScalar(FSkullyMovementKernelLanes& Lanes, const FSkullyMovementModelParams& Params, float DeltaTime);
+
+	// StepVelocity와 같은 계산을 4개 레인에 대해 분기 없이(마스크 선택) float로 수행
+	MYSKULLY_API void StepVelocitiesSimd(FSkullyMovementKernelLanes& Lanes, const FSkullyMovementModelParams& Params, float DeltaTime);
+
+	/**
+	 * 속도 단계 이후: Sweep 이동(막히면 충돌면을 따라 한 번 미끄러짐) -> 지면 판정(USkullyMovementComponent::CheckGround의 Sweep 판정과 같은 규칙)
+	 * downhill 샘플링/2-pass 바닥 재투영/쿼리 캐시는 하지 않는다.
+	 */
+	MYSKULLY_API void MoveSphere(FSkullyKernelBodyState& Body, const FVector& MoveDelta, float Radius, const FSkullyMovementModelParams& Params, float DeltaTime, FSkullyKernelSweepFunction Sweep);
+}
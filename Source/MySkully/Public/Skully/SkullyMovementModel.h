@@ -0,0 +1,62 @@
+/*
+ * 파일명: SkullyMovementModel.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 모델(중력/경사 미끄러짐/마찰/입력 가속)의 순수 계산 함수
+ *       USkullyMovementComponent와 배치 시뮬레이터(USkullyBodyBatchSubsystem)가 같은 모델을 공유한다
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 이동 모델 파라미터(USkullyMovementComponent의 튜닝 값 사본)
+struct FSkullyMovementModelParams
+{
+	float Gravity = 2000.0f;
+	float MaxSpeed = 5500.0f;
+	float Acceleration = 12000.0f;
+
+	float GroundFriction = 2000.0f;
+	float AirFriction = 100.0f;
+	float SlidingFriction = 200.0f;
+
+	float MinSlopeSlideStartSpeed = 120.0f;
+	float MaxSlopeSlideSpeed = 6000.0f;
+	float SlopeSlideScale = 2.5f;
+	float StaticFrictionAccel = 350.0f;
+	float SlideDamping = 2.0f;
+
+	float UnstableFloorZThreshold = 0.97f;
+	float FloorNormalDotEdgeThreshold = 0.95f;
+
+	// 지면 판정
+	float WalkableFloorZ = 0.7071f;
+	float GroundCheckDistance = 10.0f;
+	float MaxGroundDistance = 8.0f;
+	float GroundGraceZOffset = 0.05f;
+	float FlatGroundZThreshold = 0.997f;
+	float FloorNormalInterpSpeed = 12.0f;
+};
+
+namespace SkullyMovementModel
+{
+	// 중력 적용: Falling이면 Z 하강 가속, Grounded면 바닥을 파고들지 않도록 Z 속도를 최소 0으로 유지
+	MYSKULLY_API void ApplyGravity(FVector& Velocity, bool bGrounded, const FSkullyMovementModelParams& Params, float DeltaTime);
+
+	// 불안정 바닥(경계/급격한 노멀 변동)인지: 바닥 노멀을 믿기 어려운 상황
+	MYSKULLY_API bool IsUnstableFloor(const FVector& CachedFloorNormal, const FVector& LastFloorNormal, const FSkullyMovementModelParams& Params);
+
+	// 슬라이드에 사용할 안정화된 노멀과, 그 평면에 투영한 중력(경사 성분)
+	MYSKULLY_API FVector ComputeSlopeGravity(const FVector& CachedFloorNormal, const FVector& LastFloorNormal, const FSkullyMovementModelParams& Params, FVector& OutUseNormal);
+
+	// 경사 성분 가속(AlongPlane)으로 정지 마찰/운동 마찰/속도 제한을 적용
+	// 반환값: 이번 스텝 슬라이드 가속을 적용했는지
+	MYSKULLY_API bool ApplySlopeSlideAccel(FVector& Velocity, bool& bIsSlopeSliding, const FVector& AlongPlane, const FSkullyMovementModelParams& Params, float DeltaTime);
+
+	// 마찰 적용(XY만): 슬라이딩 중에는 속도 비례 감쇠, 그 외에는 고정 감속
+	MYSKULLY_API void ApplyFriction(FVector& Velocity, bool bGrounded, bool bIsSlopeSliding, float GroundedFriction, const FSkullyMovementModelParams& Params, float DeltaTime);
+
+	// 입력 방향으로 가속 + 최대 속력 제한(XY만)
+	MYSKULLY_API void ApplyInputAcceleration(FVector& Velocity, const FVector& InputDir, bool bHasInput, const FSkullyMovementModelParams& Params, float DeltaTime);
+}
@@ -0,0 +1,188 @@
+/*
+ * 파일명: SkullyMovementNetTypes.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: USkullyMovementComponent 클라이언트 예측/서버 보정에 쓰는 네트워크 타입(입력 무브, 상태 스냅샷, 저장된 무브)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "SkullyMovementNetTypes.generated.h"
+
+namespace SkullyNet
+{
+	// 16비트 시퀀스 비교(랩어라운드 고려): A가 B보다 나중이면 true
+	inline bool IsSequenceNewer(uint16 A, uint16 B)
+	{
+		return A != B && static_cast<uint16>(A - B) < 0x8000;
+	}
+
+	// 입력 무브 DeltaTime 양자화 단위(0.1ms)
+	constexpr float DeltaTimeQuantizeScale = 10000.0f;
+	// 입력 축 양자화 단계
+	constexpr float InputQuantizeScale = 127.0f;
+	// 무브 하나의 최대 DeltaTime(히치/레벨 로드로 한 번에 멀리 이동하는 것을 막음, 클라이언트 예측과 서버가 같은 값을 써야 보정이 생기지 않음)
+	constexpr float MaxMoveDeltaTime = 0.1f;
+}
+
+/**
+ * 클라이언트 -> 서버 입력 무브(틱 1회분)
+ * 직렬화 크기 6바이트: 시퀀스 16비트 + 입력 X/Y 각 8비트 + DeltaTime 16비트(0.1ms 단위, 최대 약 6.5초)
+ * 클라이언트도 양자화된 입력/시간으로 시뮬레이션해야 서버와 같은 결과가 나온다.
+ */
+USTRUCT()
+struct FSkullyNetInputMove
+{
+	GENERATED_BODY()
+
+	uint16 Sequence = 0;
+	int8 InputX = 0;
+	int8 InputY = 0;
+	uint16 DeltaTimeQuantized = 0;
+
+	void SetInput(const FVector& WorldInput)
+	{
+		InputX = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(WorldInput.X * SkullyNet::InputQuantizeScale), -127, 127));
+		InputY = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(WorldInput.Y * SkullyNet::InputQuantizeScale), -127, 127));
+	}
+
+	FVector GetInput() const
+	{
+		return FVector(InputX / SkullyNet::InputQuantizeScale, InputY / SkullyNet::InputQuantizeScale, 0.0f);
+	}
+
+	void SetDeltaTime(float DeltaTime)
+	{
+		DeltaTimeQuantized = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(DeltaTime * SkullyNet::DeltaTimeQuantizeScale), 1, 65535));
+	}
+
+	float GetDeltaTime() const
+	{
+		return DeltaTimeQuantized / SkullyNet::DeltaTimeQuantizeScale;
+	}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		Ar << Sequence << InputX << InputY << DeltaTimeQuantized;
+		bOutSuccess = true;
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkullyNetInputMove> : public TStructOpsTypeTraitsBase2<FSkullyNetInputMove>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * 이동 상태 스냅샷: 서버 보정(ClientAdjust)과 시뮬레이티드 프록시 복제에 사용
+ * 되감기(재시뮬레이션)에 필요한 값만 담는다.
+ * 네트워크로는 SkullyMovementStateCodec의 양자화/비트 패킹 형식으로만 보낸다(NetSerialize).
+ */
+USTRUCT()
+struct MYSKULLY_API FSkullyMovementSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Velocity = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector CachedFloorNormal = FVector::UpVector;
+
+	UPROPERTY()
+	FVector LastFloorNormal = FVector::UpVector;
+
+	// ESkullyMovementMode
+	UPROPERTY()
+	uint8 MovementMode = 0;
+
+	UPROPERTY()
+	bool bIsSlopeSliding = false;
+
+	// 고정 스텝 누적 시간
+	UPROPERTY()
+	float TimeAccumulator = 0.0f;
+
+	// 마지막 입력(시뮬레이티드 프록시의 추측 이동용, 되감기에는 사용하지 않음)
+	UPROPERTY()
+	int8 LastInputX = 0;
+
+	UPROPERTY()
+	int8 LastInputY = 0;
+
+	// 기준 상태 없이 전체 상태를 패킹(키프레임)
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkullyMovementSnapshot> : public TStructOpsTypeTraitsBase2<FSkullyMovementSnapshot>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * 비트 패킹된 이동 상태(서버 보정 RPC용)
+ * BaseSequence가 0이면 키프레임, 아니면 클라이언트가 마지막으로 받았다고 알려준 상태 기준 델타
+ */
+USTRUCT()
+struct MYSKULLY_API FSkullyPackedMovementState
+{
+	GENERATED_BODY()
+
+	uint16 BaseSequence = 0;
+	uint32 NumBits = 0;
+	TArray<uint8> Data;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSkullyPackedMovementState> : public TStructOpsTypeTraitsBase2<FSkullyPackedMovementState>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+// 클라이언트가 서버 확인(Ack) 전까지 보관하는 무브
+struct FSkullySavedMove
+{
+	FSkullyNetInputMove Move;
+	// 이 무브를 시뮬레이션한 뒤의 위치
+	FVector EndLocation = FVector::ZeroVector;
+};
+
+// 클라이언트 예측 통계(누적)
+struct FSkullyNetPredictionStats
+{
+	uint32 MovesSent = 0;
+	uint32 RpcsSent = 0;
+	uint32 BytesSent = 0;
+	uint32 Acks = 0;
+	uint32 Corrections = 0;
+	uint32 ReplayedMoves = 0;
+	// 받은 보정 상태 크기와 그중 델타로 받은 수
+	uint32 StateBytesReceived = 0;
+	uint32 DeltaStatesReceived = 0;
+
+	// 서버 응답 중 보정 비율
+	float GetCorrectionRate() const
+	{
+		const uint32 Responses = Acks + Corrections;
+		return Responses > 0 ? static_cast<float>(Corrections) / Responses : 0.0f;
+	}
+};
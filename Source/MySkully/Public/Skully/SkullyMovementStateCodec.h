@@ -0,0 +1,70 @@
+/*
+ * 파일명: SkullyMovementStateCodec.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 상태 양자화/비트 패킹(키프레임, 기준 상태 대비 델타)과 시퀀스별 상태 기록
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skully/SkullyMovementNetTypes.h"
+
+// 양자화 설정(송신 측 값이 스트림에 기록되므로 수신 측 설정과 달라도 복원 가능)
+struct FSkullyMovementStateQuantization
+{
+	// 속도 성분당 비트 수(부호 포함), +-8192cm/s 범위를 균등 분할
+	int32 VelocityBits = 16;
+	// 바닥 노멀(옥타헤드럴 인코딩) 축당 비트 수
+	int32 NormalBits = 12;
+};
+
+/**
+ * 이동 상태 패킹 형식
+ *   플래그 10비트: Grounded, Sliding, 속도 0, 속도 기준과 같음, 노멀 모두 Up, Last == Cached, 노멀 기준과 같음, 입력 있음, 누적 시간 있음, 위치 기준과 같음
+ *   위치: 키프레임은 0.01cm 단위 PackedVector, 델타는 0.01cm 단위 차이를 지그재그 + 가변 길이 정수로
+ *   속도: 비트 수(5비트) + 성분당 VelocityBits
+ *   노멀: 비트 수(4비트) + 노멀당 2 * NormalBits(옥타헤드럴)
+ *   입력 8비트 x 2, 누적 시간 16비트(0.1ms)
+ */
+namespace SkullyMovementStateCodec
+{
+	// 콘솔 변수(Skully.Net.VelocityBits, Skully.Net.NormalBits)에서 읽은 현재 설정
+	MYSKULLY_API FSkullyMovementStateQuantization GetQuantization();
+	// 키프레임을 강제로 보내는 간격(보정 횟수, Skully.Net.KeyframeInterval)
+	MYSKULLY_API int32 GetKeyframeInterval();
+
+	// Base가 nullptr이면 키프레임
+	MYSKULLY_API void Write(FArchive& Ar, const FSkullyMovementSnapshot& State, const FSkullyMovementSnapshot* Base, const FSkullyMovementStateQuantization& Quantization);
+	MYSKULLY_API bool Read(FArchive& Ar, FSkullyMovementSnapshot& OutState, const FSkullyMovementSnapshot* Base);
+
+	// State를 패킹한 비트 수(벤치마크용)
+	MYSKULLY_API int64 GetPackedBits(const FSkullyMovementSnapshot& State, const FSkullyMovementSnapshot* Base, const FSkullyMovementStateQuantization& Quantization);
+
+	// 위치를 Base 기준 델타로 쓸 수 있는지(차이가 너무 크면 키프레임으로 써야 함)
+	MYSKULLY_API bool IsLocationDeltaEncodable(const FVector& Location, const FVector& BaseLocation);
+
+	// 패킹 후 복원한 값(송신 측이 기준 상태로 보관해야 수신 측과 같은 값을 기준으로 씀)
+	MYSKULLY_API bool Pack(FSkullyPackedMovementState& OutPacked, const FSkullyMovementSnapshot& State, const FSkullyMovementSnapshot* Base, uint16 BaseSequence, FSkullyMovementSnapshot& OutQuantizedState);
+	MYSKULLY_API bool Unpack(const FSkullyPackedMovementState& Packed, const FSkullyMovementSnapshot* Base, FSkullyMovementSnapshot& OutState);
+
+	// 옥타헤드럴 노멀 인코딩(축당 Bits비트, 결과는 2 * Bits비트)
+	MYSKULLY_API uint32 EncodeNormal(const FVector& Normal, int32 Bits);
+	MYSKULLY_API FVector DecodeNormal(uint32 Encoded, int32 Bits);
+}
+
+// 시퀀스별 상태 기록(서버: 보낸 상태, 클라이언트: 받은 상태), 델타의 기준 상태 조회용
+class MYSKULLY_API FSkullyMovementStateHistory
+{
+public:
+	static constexpr int32 Capacity = 32;
+
+	void Add(uint16 Sequence, const FSkullyMovementSnapshot& State);
+	const FSkullyMovementSnapshot* Find(uint16 Sequence) const;
+	void Reset();
+
+private:
+	FSkullyMovementSnapshot States[Capacity];
+	uint16 Sequences[Capacity] = {};
+	bool bValid[Capacity] = {};
+};
@@ -0,0 +1,102 @@
+/*
+ * 파일명: SkullyMovementStats.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 관련 stat 그룹/카운터(stat SkullyMovement)와 Unreal Insights 트레이스 채널(SkullyMovementChannel)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+DECLARE_STATS_GROUP(TEXT("SkullyMovement"), STATGROUP_SkullyMovement, STATCAT_Advanced);
+
+// 단계별 사이클 카운터
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick"), STAT_SkullyMovementTick, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ApplyGravity"), STAT_SkullyApplyGravity, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ApplySlopeSlide"), STAT_SkullyApplySlopeSlide, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ApplyFriction"), STAT_SkullyApplyFriction, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Move"), STAT_SkullyMove, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CheckGround"), STAT_SkullyCheckGround, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SnapToGround"), STAT_SkullySnapToGround, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Body Batch Step"), STAT_SkullyBodyBatchStep, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 스텝/쿼리 카운터(프레임마다 초기화)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Simulation Steps"), STAT_SkullySimulationSteps, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Move Sweeps"), STAT_SkullyMoveSweeps, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Move Iterations"), STAT_SkullyMoveIterations, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Move Iteration Limit Hits"), STAT_SkullyMoveIterationLimitHits, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Move Depenetrations"), STAT_SkullyMoveDepenetrations, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Sweeps"), STAT_SkullyGroundSweeps, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Sweeps Reused On Moving Base"), STAT_SkullyGroundSweepsReusedOnBase, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Sweeps From Walkability Field"), STAT_SkullyGroundSweepsFromField, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Line Traces"), STAT_SkullyGroundLineTraces, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("SlideAlongSurface Retries"), STAT_SkullySlideAlongSurface, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Floor Re-projections (2-pass)"), STAT_SkullyFloorReprojections, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batch Body Steps"), STAT_SkullyBatchBodySteps, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 클라이언트 예측(전송 무브/바이트, 서버 보정, 보정 후 재시뮬레이션한 무브, 보낸 보정 상태 바이트)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Moves Sent"), STAT_SkullyNetMovesSent, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Move Bytes"), STAT_SkullyNetMoveBytes, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Corrections"), STAT_SkullyNetCorrections, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Replayed Moves"), STAT_SkullyNetReplayedMoves, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net State Bytes"), STAT_SkullyNetStateBytes, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 잠든(틱을 끄거나 낮춘) 이동 컴포넌트 수(프레임마다 초기화하지 않음)
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Sleeping Bodies"), STAT_SkullySleepingBodies, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 바닥 감지 쿼리(SweepGround, 보조 라인트레이스, downhill 샘플)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Probes (Simple)"), STAT_SkullyGroundProbeSimple, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Probes (Complex)"), STAT_SkullyGroundProbeComplex, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Probe Complex Fallbacks"), STAT_SkullyGroundProbeComplexFallback, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 카메라 스프링 암 충돌 프로브(동기 스윕, 비동기 스윕 요청, 캐시 재사용/대기로 생략)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Probes (Sync)"), STAT_SkullyCameraProbesSync, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Probes (Async)"), STAT_SkullyCameraProbesAsync, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Probes Skipped"), STAT_SkullyCameraProbesSkipped, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 기믹 공간 해시(격자 칸 이동 알림, 트리거 포함 검사)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Gimmick Cell Crossings"), STAT_SkullyGimmickCellCrossings, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Gimmick Trigger Tests"), STAT_SkullyGimmickEvaluations, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// 비주얼(메시) 트랜스폼 갱신(실제 갱신, 오프셋/회전 따로 갱신 대비 줄어든 횟수)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visual Transform Updates"), STAT_SkullyVisualTransformUpdates, STATGROUP_SkullyMovement, MYSKULLY_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visual Transform Updates Saved"), STAT_SkullyVisualTransformUpdatesSaved, STATGROUP_SkullyMovement, MYSKULLY_API);
+
+// Insights 트레이스 채널(-trace=cpu,SkullyMovement 또는 Trace.Enable SkullyMovement)
+UE_TRACE_CHANNEL_EXTERN(SkullyMovementChannel, MYSKULLY_API);
+
+// stat 사이클 카운터 + Insights CPU 스코프(Stats가 빠진 Test/Shipping 빌드에서도 Insights에 표시)
+#define SKULLY_MOVEMENT_SCOPE(StatId, TraceName) \
+	SCOPE_CYCLE_COUNTER(StatId); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(TraceName)
+
+// 트레이스 채널로 기록하는 이동 상태 전환 이벤트
+enum class ESkullyMovementTraceEvent : uint8
+{
+	Landed,
+	StartedFalling,
+	SlideStarted,
+	SlideStopped,
+	Slept,
+	Woke
+};
+
+// 이동 상태 전환을 SkullyMovementChannel에 기록(채널이 꺼져 있으면 비용 없음)
+MYSKULLY_API void SkullyTraceMovementEvent(const UObject* Source, ESkullyMovementTraceEvent Event, const FVector& Location, float Speed);
+
+// 바닥 감지 쿼리 수를 정밀도(Simple/Complex)별로 카운트
+inline void SkullyCountGroundProbe(bool bTraceComplex, int32 Count = 1)
+{
+	if (bTraceComplex == true)
+	{
+		INC_DWORD_STAT_BY(STAT_SkullyGroundProbeComplex, Count);
+	}
+	else
+	{
+		INC_DWORD_STAT_BY(STAT_SkullyGroundProbeSimple, Count);
+	}
+}
@@ -0,0 +1,63 @@
+/*
+ * 파일명: SkullyMovingPlatform.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 왕복 이동 + 회전하는 움직이는 발판(움직이는 바닥 추적 테스트/벤치마크용)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SkullyMovingPlatform.generated.h"
+
+class UStaticMeshComponent;
+
+/**
+ * 시작 위치에서 MoveOffset까지 코사인 곡선으로 왕복하고, RotationRate로 계속 회전하는 발판
+ * 충돌만 있는 키네마틱 이동(스윕 없음)이므로 위에 있는 Skully는 USkullyMovementComponent의 바닥 추적으로 따라간다.
+ */
+UCLASS()
+class MYSKULLY_API ASkullyMovingPlatform : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASkullyMovingPlatform();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	// 시작 후 Time초 시점의 위치/회전으로 이동(벤치마크는 Tick을 끄고 직접 호출)
+	void UpdatePlatform(float Time);
+
+	// 시작 위치 기준 왕복 끝 위치
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform")
+	FVector MoveOffset = FVector(0.0f, 800.0f, 0.0f);
+
+	// 왕복 한 번에 걸리는 시간(초)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform", meta = (ClampMin = "0.1"))
+	float MovePeriod = 4.0f;
+
+	// 초당 회전량
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform")
+	FRotator RotationRate = FRotator::ZeroRotator;
+
+	// 왕복 시작 시점(초), 같은 발판 여러 개의 위상을 어긋나게 할 때 사용
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platform")
+	float TimeOffset = 0.0f;
+
+	UStaticMeshComponent* GetPlatformMesh() const { return PlatformMesh; }
+
+private:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Platform", meta = (AllowPrivateAccess = "true"))
+	UStaticMeshComponent* PlatformMesh;
+
+	FVector StartLocation = FVector::ZeroVector;
+	FRotator StartRotation = FRotator::ZeroRotator;
+	float ElapsedTime = 0.0f;
+};
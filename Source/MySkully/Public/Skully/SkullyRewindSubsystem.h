@@ -0,0 +1,132 @@
+/*
+ * 파일명: SkullyRewindSubsystem.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully 이동 상태와 기믹 상태를 링 버퍼에 델타 인코딩으로 기록하고 되감기/체크포인트 복원하는 월드 서브시스템
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/BitWriter.h"
+#include "Skully/SkullyMovementNetTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkullyRewindSubsystem.generated.h"
+
+class ASkullyGimmick;
+class USkullyMovementComponent;
+
+/**
+ * 퍼즐 재시도용 되감기
+ * RecordRate마다 등록된 몸체(FSkullyMovementSnapshot, SkullyMovementStateCodec 델타)와
+ * 기믹(ASkullyGimmick::SerializeRewindState, 직전과 같으면 1비트)을 한 프레임으로 비트 패킹해
+ * 미리 할당한 원형 바이트 아레나에 쌓는다. KeyframeInterval마다 키프레임을 넣고,
+ * 아레나나 프레임 수가 차면 가장 오래된 프레임부터(다음 키프레임까지) 버린다.
+ * 되감기는 목표 프레임 이전 키프레임부터 목표까지 디코드해 적용하고 이후 기록은 버린다.
+ * 체크포인트는 링 밖에 키프레임 하나로 보관하므로 링이 돌아도 남는다.
+ */
+UCLASS()
+class MYSKULLY_API USkullyRewindSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 기록 대상 등록/해제
+	void RegisterBody(USkullyMovementComponent* Body);
+	void UnregisterBody(USkullyMovementComponent* Body);
+	void RegisterGimmick(ASkullyGimmick* Gimmick);
+	void UnregisterGimmick(ASkullyGimmick* Gimmick);
+
+	// Seconds초 전 프레임으로 되감기(기록보다 길면 가장 오래된 프레임)
+	UFUNCTION(BlueprintCallable, Category = "Rewind")
+	bool RewindSeconds(float Seconds);
+	
+	// 현재 상태를 이름으로 저장/복원(복원하면 링 기록은 비움)
+	UFUNCTION(BlueprintCallable, Category = "Rewind")
+	void SaveCheckpoint(FName Name);
+	UFUNCTION(BlueprintCallable, Category = "Rewind")
+	bool RestoreCheckpoint(FName Name);
+	
+	// 기록된 시간(초)
+	UFUNCTION(BlueprintPure, Category = "Rewind")
+	float GetRecordedDuration() const;
+	
+	int32 GetNumFrames() const { return NumFrames; }
+	int32 GetArenaUsedBytes() const { return ArenaUsedBytes; }
+	int32 GetArenaSize() const { return Arena.Num(); }
+
+private:
+	// 링의 한 프레임
+	struct FFrameRecord
+	{
+		double Time = 0.0;
+		int32 Offset = 0;
+		int32 NumBytes = 0;
+		int64 NumBits = 0;
+		bool bKeyframe = false;
+	};
+	
+	// 디코드한(= 인코더가 다음 델타의 기준으로 쓰는) 대상별 상태
+	struct FDecodeState
+	{
+		TMap<uint32, FSkullyMovementSnapshot> Bodies;
+		TMap<uint32, TArray<uint8>> Gimmicks;
+	};
+	
+	// 현재 상태를 한 프레임으로 인코딩(키프레임이면 Bases를 쓰지 않음)
+	void EncodeFrame(FBitWriter& Writer, bool bKeyframe, const FDecodeState& Bases);
+	// 한 프레임 디코드(키프레임이면 State를 비우고 시작), 프레임에 들어 있던 대상 ID
+	bool DecodeFrame(const uint8* Data, int64 NumBits, FDecodeState& State, TArray<uint32>& OutBodyIds, TArray<uint32>& OutGimmickIds) const;
+	// 디코드한 상태를 대상에 적용
+	void ApplyState(const FDecodeState& State, const TArray<uint32>& BodyIds, const TArray<uint32>& GimmickIds);
+	
+	// 링에 프레임 추가/조회/제거
+	void RecordFrame();
+	bool PushFrame(const uint8* Data, int32 NumBytes, int64 NumBits, bool bKeyframe);
+	const uint8* GetFrameData(const FFrameRecord& Record, TArray<uint8>& Scratch) const;
+	FFrameRecord& GetFrame(int32 Index) { return Frames[(FirstFrame + Index) % Frames.Num()]; }
+	const FFrameRecord& GetFrame(int32 Index) const { return Frames[(FirstFrame + Index) % Frames.Num()]; }
+	void PopOldestFrame();
+	void ClearFrames();
+	
+	// 링의 Index번째 프레임으로 되감기
+	bool RestoreFrame(int32 Index);
+
+private:
+	// 미리 할당한 원형 바이트 아레나와 프레임 링
+	TArray<uint8> Arena;
+	int32 ArenaWriteOffset = 0;
+	int32 ArenaUsedBytes = 0;
+	TArray<FFrameRecord> Frames;
+	int32 FirstFrame = 0;
+	int32 NumFrames = 0;
+	
+	// 기록 시계(되감으면 함께 되돌아가므로 프레임 시간이 끊기지 않음)
+	double RecordClock = 0.0;
+	
+	// 마지막으로 기록한 프레임을 디코드한 상태(다음 델타의 기준)
+	FDecodeState EncoderState;
+	int32 FramesSinceKeyframe = 0;
+	float RecordAccumulator = 0.0f;
+	
+	// 기록 대상(ID는 프레임 안에서 대상을 구분)
+	TMap<uint32, TWeakObjectPtr<USkullyMovementComponent>> Bodies;
+	TMap<uint32, TWeakObjectPtr<ASkullyGimmick>> Gimmicks;
+	uint32 NextSubjectId = 1;
+	
+	// 체크포인트(키프레임 하나)
+	struct FCheckpoint
+	{
+		TArray<uint8> Data;
+		int64 NumBits = 0;
+	};
+	TMap<FName, FCheckpoint> Checkpoints;
+	
+	// 인코딩 임시 버퍼
+	TArray<uint8> GimmickScratch;
+};
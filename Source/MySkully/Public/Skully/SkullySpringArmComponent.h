@@ -0,0 +1,94 @@
+/*
+ * 파일명: SkullySpringArmComponent.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 카메라 충돌 프로브 빈도를 조절하는 Skully 전용 스프링 암
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "WorldCollision.h"
+#include "SkullySpringArmComponent.generated.h"
+
+/**
+ * 카메라 충돌 프로브 예산
+ * 기본 스프링 암은 매 프레임 암 원점에서 카메라 위치까지 Sphere Sweep을 하지만,
+ * 이 컴포넌트는 원점/카메라 위치가 거의 그대로이면 직전 결과(막힌 거리)를 재사용하고
+ * 움직이는 동안에는 비동기 스윕을 요청해 다음 프레임에 결과를 받는다.
+ * 결과가 한 프레임 늦게 오는 것은 막힌 거리의 보간(당길 때 빠르게, 풀 때 느리게)으로 가린다.
+ */
+UCLASS(ClassGroup = Camera, meta = (BlueprintSpawnableComponent))
+class MYSKULLY_API USkullySpringArmComponent : public USpringArmComponent
+{
+	GENERATED_BODY()
+
+public:
+	USkullySpringArmComponent();
+
+	// 다음 갱신에서 캐시를 무시하고 동기 스윕을 강제(순간이동/컷 전환 직후 호출)
+	UFUNCTION(BlueprintCallable, Category = "CameraCollision|Budget")
+	void InvalidateProbe();
+
+protected:
+	virtual void OnUnregister() override;
+	virtual void UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime) override;
+
+private:
+	// 이번 프레임에 스윕이 필요한지(원점/카메라 위치 변화, 재사용 시간 초과)
+	bool NeedsProbe(const FVector& ArmOrigin, const FVector& DesiredLoc) const;
+	// 동기 스윕 후 막힌 거리 갱신
+	void ProbeSync(const FVector& ArmOrigin, const FVector& DesiredLoc);
+	// 비동기 스윕 요청(이미 요청 중이면 결과가 올 때까지 기다림)
+	void ProbeAsync(const FVector& ArmOrigin, const FVector& DesiredLoc);
+	void OnAsyncProbeDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+	// 스윕 결과를 원점으로부터의 막힌 거리로 저장
+	void StoreProbeResult(const FVector& ArmOrigin, const FVector& DesiredLoc, bool bBlockingHit, const FVector& HitLocation);
+
+protected:
+// 프로브 예산 파라미터
+	// 원점/카메라 위치가 이 거리(cm) 이하로 변했으면 직전 스윕 결과를 재사용
+	// 늘리면? 스윕이 더 자주 생략되지만 카메라가 벽 안으로 살짝 들어갈 수 있음
+	// 줄이면? 작은 흔들림에도 다시 스윕함
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision|Budget", meta = (ClampMin = "0.0"))
+	float ProbeReuseDistance = 1.0f;
+	
+	// 변화가 없어도 이 시간(초)이 지나면 다시 스윕(움직이는 기믹이 카메라와 폰 사이로 들어오는 경우 대비)
+	// 늘리면? 정지 중 스윕이 더 줄지만 움직이는 장애물에 늦게 반응함
+	// 줄이면? 장애물에 빨리 반응하지만 정지 중에도 스윕이 늘어남
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision|Budget", meta = (ClampMin = "0.0"))
+	float MaxProbeInterval = 0.25f;
+	
+	// 움직이는 동안 비동기 스윕 사용(결과는 다음 프레임에 반영)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision|Async")
+	bool bUseAsyncProbe = true;
+	
+	// 막힌 거리가 줄어드는(카메라를 당기는) 속도(cm/s, 0이면 기본 스프링 암처럼 즉시)
+	// 늘리면? 즉시 당김에 가까워짐
+	// 줄이면? 당김이 부드럽지만 그동안 벽 안이 보일 수 있음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision|Async", meta = (ClampMin = "0.0"))
+	float ProbePullInSpeed = 0.0f;
+	
+	// 막힌 거리가 늘어나는(카메라를 다시 빼는) 속도(cm/s, 0이면 즉시)
+	// 늘리면? 장애물을 벗어나자마자 원래 거리로 돌아옴
+	// 줄이면? 복귀가 느려지지만 장애물 경계에서 카메라가 덜 튐
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision|Async", meta = (ClampMin = "0.0"))
+	float ProbeRecoverSpeed = 3000.0f;
+
+private:
+	// 직전 스윕을 한 원점/카메라 위치와 시간
+	FVector LastProbeOrigin = FVector::ZeroVector;
+	FVector LastProbeDesiredLoc = FVector::ZeroVector;
+	double LastProbeTime = -1.0;
+	bool bHasProbeResult = false;
+	
+	// 스윕 결과: 원점으로부터 카메라까지 막히지 않은 거리(막히지 않았으면 MAX_FLT)
+	float ProbeBlockedDistance = MAX_FLT;
+	// 보간 중인 막힌 거리(실제로 카메라를 놓는 거리)
+	float SmoothedBlockedDistance = MAX_FLT;
+	
+	// 진행 중인 비동기 스윕
+	FTraceHandle PendingProbeHandle;
+	FTraceDelegate AsyncProbeDelegate;
+};
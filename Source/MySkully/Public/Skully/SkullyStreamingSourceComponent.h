@@ -0,0 +1,119 @@
+/*
+ * 파일명: SkullyStreamingSourceComponent.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: Skully의 속도/이동 방향으로 앞쪽 경로를 예측해 월드 파티션 셀을 미리 로드하는 스트리밍 소스
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
+#include "SkullyStreamingSourceComponent.generated.h"
+
+class AController;
+class APawn;
+class USkullyMovementComponent;
+
+/**
+ * 예측 스트리밍 소스
+ * 기본 플레이어 소스는 현재 위치 기준이라 빠른 슬라이드(5500~6000 cm/s)가 셀 로드를 앞지른다.
+ * 이 컴포넌트는 CurrentSpeed2D/CurrentMoveDir2D로 LookAheadTime 뒤까지의 직선 경로에 소스를 여러 개 놓고,
+ * 가까운(먼저 도착할) 지점일수록 높은 우선순위를 준다.
+ * 예측 지점마다 셀 로드 완료 시각과 실제 도착 시각을 비교해 로그로 남긴다.
+ * 서버(또는 단독 실행)와 로컬 플레이어의 Skully만 소스를 낸다(클라이언트의 다른 플레이어 Skully는 제외).
+ */
+UCLASS(ClassGroup = Skully, meta = (BlueprintSpawnableComponent))
+class MYSKULLY_API USkullyStreamingSourceComponent : public UActorComponent, public IWorldPartitionStreamingSourceProvider
+{
+	GENERATED_BODY()
+
+public:
+	USkullyStreamingSourceComponent();
+
+	// IWorldPartitionStreamingSourceProvider
+	virtual bool GetStreamingSources(TArray<FWorldPartitionStreamingSource>& OutStreamingSources) const override;
+	virtual const UObject* GetStreamingSourceOwner() const override { return this; }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	// 예측 경로(현재 위치, 방향, 길이), 예측하지 않을 속도면 false
+	bool GetPredictedPath(FVector& OutOrigin, FVector& OutDirection, float& OutLength) const;
+	// 예측 지점의 로드 완료/도착 확인 및 로그
+	void UpdateArrivalMetrics(double Now);
+	
+	// 이 머신이 소스를 내야 하는지(서버이거나 로컬 플레이어가 조종 중)
+	bool ShouldProvideSources() const;
+	// 조건에 맞춰 월드 파티션 소스 제공자 등록/해제
+	void UpdateProviderRegistration();
+	// 클라이언트에서는 BeginPlay 이후에 컨트롤러가 복제되므로 빙의가 바뀔 때 다시 확인
+	UFUNCTION()
+	void OnOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+protected:
+// 예측 파라미터
+	// 이 속력(cm/s) 이상일 때만 예측 소스를 냄(느릴 때는 기본 플레이어 소스로 충분)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Prediction", meta = (ClampMin = "0.0"))
+	float MinPredictionSpeed = 1500.0f;
+	
+	// 몇 초 뒤 위치까지 미리 로드할지
+	// 늘리면? 더 멀리 미리 로드하지만 방향을 틀면 버려지는 로드가 늘어남
+	// 줄이면? 헛로드는 줄지만 로드 시간이 긴 셀은 도착 전에 끝나지 않음
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Prediction", meta = (ClampMin = "0.0"))
+	float LookAheadTime = 2.0f;
+	
+	// 예측 경로 최대 길이(cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Prediction", meta = (ClampMin = "0.0"))
+	float MaxLookAheadDistance = 15000.0f;
+	
+	// 경로 위에 놓는 소스 수(경로를 균등하게 나눔)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Prediction", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 NumPathSources = 3;
+	
+	// 경로 소스의 로딩 범위(그리드 로딩 범위에 곱함)
+	// 늘리면? 경로 옆으로 벗어나도 로드되어 있지만 로드량이 늘어남
+	// 줄이면? 경로를 따라 좁게만 로드함
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Prediction", meta = (ClampMin = "0.0"))
+	float PathLoadingRangeScale = 0.5f;
+	
+// 지표 파라미터
+	// 로드 지연/도착 시간 로그
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Metrics")
+	bool bLogStreamingMetrics = true;
+	
+	// 새 예측 지점을 기록하는 간격(초)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Metrics", meta = (ClampMin = "0.05"))
+	float MetricsSampleInterval = 0.5f;
+	
+	// 예측 지점 도착/로드 판정 반경(cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|Metrics", meta = (ClampMin = "0.0"))
+	float ArrivalRadius = 1000.0f;
+
+private:
+	// 로드/도착을 기다리는 예측 지점
+	struct FPendingPrediction
+	{
+		FVector Location = FVector::ZeroVector;
+		double RequestTime = 0.0;
+		double ExpectedArrivalTime = 0.0;
+		double LoadedTime = -1.0;
+	};
+	
+	TWeakObjectPtr<USkullyMovementComponent> MovementComponent;
+	TArray<FName> SourceNames;
+	bool bRegisteredProvider = false;
+	
+	TArray<FPendingPrediction> PendingPredictions;
+	double LastPredictionTime = -1.0;
+	
+	// 누적 지표(EndPlay에서 요약)
+	int32 NumArrivals = 0;
+	int32 NumLateArrivals = 0;
+	double TotalLoadLatency = 0.0;
+	double TotalArrivalMargin = 0.0;
+};
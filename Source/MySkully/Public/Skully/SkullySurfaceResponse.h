@@ -0,0 +1,76 @@
+/*
+ * 파일명: SkullySurfaceResponse.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 바닥 물리 머티리얼(UPhysicalMaterial)별 Skully 이동 반응(마찰, 슬라이드 감쇠, 정지 임계치, 최대 슬라이드 속도) 테이블
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "SkullySurfaceResponse.generated.h"
+
+class UPhysicalMaterial;
+struct FSkullyMovementModelParams;
+
+// 바닥 하나의 이동 반응(기본값은 USkullyMovementComponent 기본값과 같음)
+USTRUCT(BlueprintType)
+struct MYSKULLY_API FSkullySurfaceResponse
+{
+	GENERATED_BODY()
+
+	// 마찰력(GroundFriction)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0.0"))
+	float GroundFriction = 2000.0f;
+
+	// 경사면 미끄러짐 중 마찰력(SlidingFriction)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0.0"))
+	float SlidingFriction = 200.0f;
+
+	// 슬라이딩 중 속도 댐핑 계수(SlideDamping)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0.0"))
+	float SlideDamping = 2.0f;
+
+	// 정지 마찰 가속도 임계치(StaticFrictionAccel), 얼음처럼 작으면 완만한 경사에서도 미끄러짐
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0.0"))
+	float StaticFrictionAccel = 350.0f;
+
+	// 경사면에서 내려가는 최대 속도(MaxSlopeSlideSpeed)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0.0"))
+	float MaxSlopeSlideSpeed = 6000.0f;
+
+	// 이동 모델 파라미터에 덮어씀
+	void ApplyTo(FSkullyMovementModelParams& Params) const;
+};
+
+/**
+ * 물리 머티리얼 -> 이동 반응 테이블
+ * USkullyMovementComponent는 바닥 프리미티브가 바뀔 때만 이 테이블을 조회하고 결과 사본을 프리미티브별로 캐시한다.
+ * 테이블 내용이 바뀌면 변경 카운터가 올라가고, 컴포넌트는 카운터가 다르면 캐시를 비운다.
+ * 테이블에 없는 머티리얼(또는 머티리얼 없는 바닥)은 컴포넌트 자체 값을 그대로 쓴다.
+ */
+UCLASS(BlueprintType)
+class MYSKULLY_API USkullySurfaceResponseTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// 없으면 nullptr(TMap 내부 포인터이므로 보관하지 말 것)
+	const FSkullySurfaceResponse* Find(const UPhysicalMaterial* PhysicalMaterial) const;
+	
+	// Responses를 코드에서 바꿨으면 호출(캐시 무효화)
+	void NotifyResponsesChanged() { ++ChangeCounter; }
+	uint32 GetChangeCounter() const { return ChangeCounter; }
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Surface")
+	TMap<TObjectPtr<UPhysicalMaterial>, FSkullySurfaceResponse> Responses;
+
+private:
+	// 내용이 바뀔 때마다 증가(저장하지 않음)
+	uint32 ChangeCounter = 0;
+};
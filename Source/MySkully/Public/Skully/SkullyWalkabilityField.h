@@ -0,0 +1,90 @@
+/*
+ * 파일명: SkullyWalkabilityField.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 정적 레벨의 2.5D 바닥 격자(높이/노멀/바닥 프리미티브)를 에디터에서 미리 구워 둔 에셋
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "SkullyWalkabilityField.generated.h"
+
+// 셀 하나를 풀어낸 값
+struct FSkullyWalkabilityCell
+{
+	// 셀 중심의 바닥 높이
+	float Height = 0.0f;
+	FVector Normal = FVector::UpVector;
+	// USkullyWalkabilityField::Surfaces 인덱스
+	int32 SurfaceIndex = INDEX_NONE;
+};
+
+/**
+ * 바닥 격자 에셋
+ * 셀마다 위에서 아래로 한 번 트레이스한 가장 위 바닥을 평면(높이 + 노멀)으로 저장한다.
+ * - Static 프리미티브이고 셀 안에서 평면(중심/모서리 샘플이 같은 평면)인 셀만 굽는다. 엣지/계단/벽이 걸친 셀은 비워 둔다.
+ * - 걸을 수 있는지는 저장하지 않고 런타임에 노멀 Z와 컴포넌트의 허용 경사각으로 판정한다(튜닝 값이 바뀌어도 다시 구울 필요 없음).
+ * - 셀 하나는 8바이트: 높이 16비트 + 옥타헤드럴 노멀 24비트 + 바닥 프리미티브 번호 16비트(0이면 구워지지 않은 셀)
+ * 에셋 경로는 맵마다 고정(GetAssetPathForWorld)이고 USkullyWalkabilitySubsystem이 월드 시작 시 읽는다.
+ */
+UCLASS()
+class MYSKULLY_API USkullyWalkabilityField : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Serialize(FArchive& Ar) override;
+
+	// 위치가 들어 있는 셀 좌표(격자 밖이면 false)
+	bool GetCellCoord(const FVector& Location, int32& OutX, int32& OutY) const;
+	// 구워진 셀이면 true
+	bool GetCell(int32 X, int32 Y, FSkullyWalkabilityCell& OutCell) const;
+	// 셀 중심의 월드 XY
+	FVector2D GetCellCenter(int32 X, int32 Y) const;
+
+	int32 GetNumCells() const { return Cells.Num(); }
+	int64 GetCellBytes() const { return Cells.Num() * static_cast<int64>(sizeof(uint64)); }
+
+	// 맵별 에셋 경로(/Game/Walkability/<맵 이름>_Walkability.<맵 이름>_Walkability)
+	static FString GetAssetPathForWorld(const UWorld* World);
+
+#if WITH_EDITOR
+	// 월드의 Static 지오메트리로 격자를 구움(CellSize: 셀 한 변 길이(cm))
+	void Bake(UWorld* World, float InCellSize);
+#endif
+
+public:
+	// 격자 원점(최소 XY)과 셀 크기, 셀 수
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	FVector2D Origin = FVector2D::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	float CellSize = 50.0f;
+
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	int32 SizeX = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	int32 SizeY = 0;
+
+	// 높이 양자화: Height = MinZ + 저장값 * HeightQuantum
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	float MinZ = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	float HeightQuantum = 1.0f;
+
+	// 셀이 가리키는 바닥 프리미티브(레벨 안 컴포넌트 경로)
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	TArray<FSoftObjectPath> Surfaces;
+
+	// 구워진 셀 수(통계용)
+	UPROPERTY(VisibleAnywhere, Category = "Walkability")
+	int32 NumBakedCells = 0;
+
+private:
+	// 셀 배열(행 우선, Y * SizeX + X), 프로퍼티 태그 없이 한 블록으로 직렬화
+	TArray<uint64> Cells;
+};
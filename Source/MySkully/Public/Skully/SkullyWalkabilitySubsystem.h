@@ -0,0 +1,64 @@
+/*
+ * 파일명: SkullyWalkabilitySubsystem.h
+ * 생성일: 2026-10-17
+ * 수정일: 2026-10-17
+ * 내용: 구워진 바닥 격자(USkullyWalkabilityField)를 읽어 바닥 감지를 씬 쿼리 없이 대신하는 월드 서브시스템
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkullyWalkabilitySubsystem.generated.h"
+
+class UPrimitiveComponent;
+class USkullyWalkabilityField;
+
+/**
+ * 바닥 격자 조회
+ * 구의 발밑(반지름 범위) 셀이 모두 구워져 있고 같은 프리미티브의 같은 평면이면, 아래 방향 Sphere Sweep 결과를 평면 식으로 계산한다.
+ * 구워지지 않은 셀, 평면이 아닌 발밑(엣지/계단), 움직이는 프리미티브 근처에서는 false를 반환하고 호출자가 씬 쿼리로 감지한다.
+ * 움직이는 프리미티브(발판 등)는 RegisterDynamicPrimitive로 등록해 두면 매 틱 겹치는 셀을 표시한다.
+ */
+UCLASS()
+class MYSKULLY_API USkullyWalkabilitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 사용할 격자 교체(굽기 직후 적용, nullptr이면 끔)
+	void SetField(USkullyWalkabilityField* NewField);
+	const USkullyWalkabilityField* GetField() const { return Field; }
+
+	// 격자 위를 지나가는 움직이는 프리미티브 등록/해제
+	void RegisterDynamicPrimitive(UPrimitiveComponent* Primitive);
+	void UnregisterDynamicPrimitive(UPrimitiveComponent* Primitive);
+
+	/**
+	 * Center에서 아래로 SweepDistance만큼 반지름 Radius 구를 스윕한 결과를 격자로 계산
+	 * 거리가 MaxDistance 이하이고 노멀 Z가 MinNormalZ 이상인 확실한 바닥일 때만 true(나머지는 씬 쿼리로 판정)
+	 */
+	bool SweepGround(const FVector& Center, float Radius, float SweepDistance, float MaxDistance, float MinNormalZ, FHitResult& OutHit);
+
+private:
+	// 셀이 가리키는 바닥 프리미티브(스트리밍으로 아직 로드되지 않았으면 nullptr)
+	UPrimitiveComponent* ResolveSurface(int32 SurfaceIndex);
+	// 등록된 움직이는 프리미티브가 겹치는 셀 다시 표시
+	void UpdateDynamicCells();
+
+private:
+	UPROPERTY()
+	TObjectPtr<USkullyWalkabilityField> Field;
+
+	// Field->Surfaces를 찾은 결과
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> ResolvedSurfaces;
+
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> DynamicPrimitives;
+	// 움직이는 프리미티브가 겹치는 셀(Y * SizeX + X)
+	TBitArray<> DynamicCells;
+};